@@ -519,7 +519,7 @@ int myMain( int argc, const char ** argv )
                 text = oyjlStr_Pull( t );
                 oyjlStr_Release( &t );
               }
-              free(oiJS);
+              oyjlTreeFree(oiJS);
             } else
             if(strcmp(wrap,"C") != 0)
             {
@@ -214,6 +214,11 @@ OYJL_API oyjl_val oyjlTreeGet ( oyjl_val parent, const char ** path, oyjl_type t
 #undef Florian_Forster_SOURCE_GUARD
 
 #define OYJL_NUMBER_DETECTION 0x01     /**< @brief try to parse values as number */
+#define OYJL_INTERN           0x04     /**< @brief share storage of equal object keys */
+oyjl_val   oyjlTreeParseJson         ( const char        * input,
+                                       int                 flags,
+                                       char              * error_buffer,
+                                       size_t              error_buffer_size );
 #if defined(OYJL_HAVE_LIBXML2)
 oyjl_val   oyjlTreeParseXml          ( const char        * xml,
                                        int                 flags,
@@ -234,6 +239,7 @@ void       oyjlTreeClearValue        ( oyjl_val            root,
 #define    OYJL_YAML                   0x01   /**< @brief  YAML format */
 #define    OYJL_XML                    0x08   /**< @brief  XML format */
 #define    OYJL_NO_MARKUP              0x100  /**< @brief  plain text; use oyjlTermColorToPlain() */
+#define    OYJL_JSON_COMPACT           0x200  /**< @brief  JSON without line breaks and indentation */
 char *     oyjlTreeToText            ( oyjl_val            v,
                                        int                 flags );
 void       oyjlTreeToJson            ( oyjl_val            v,
@@ -245,6 +251,32 @@ void       oyjlTreeToYaml            ( oyjl_val            v,
 void       oyjlTreeToXml             ( oyjl_val            v,
                                        int               * level,
                                        char             ** xml );
+/** @brief sink for streamed text; returns 0 on success */
+typedef int (* oyjlWrite_f)          ( const char        * text,
+                                       size_t              len,
+                                       void              * user_data );
+int        oyjlTreeWriteJson         ( oyjl_val            v,
+                                       int                 flags,
+                                       oyjlWrite_f         write,
+                                       void              * user_data );
+int        oyjlTreeWriteYaml         ( oyjl_val            v,
+                                       int                 flags,
+                                       oyjlWrite_f         write,
+                                       void              * user_data );
+int        oyjlTreeWriteXml          ( oyjl_val            v,
+                                       int                 flags,
+                                       oyjlWrite_f         write,
+                                       void              * user_data );
+int        oyjlTreeWriteJsonYajl     ( oyjl_val            v,
+                                       int                 flags,
+                                       oyjlWrite_f         write,
+                                       void              * user_data );
+int        oyjlWriteToFILE           ( const char        * text,
+                                       size_t              len,
+                                       void              * user_data );
+int        oyjlWriteToFd             ( const char        * text,
+                                       size_t              len,
+                                       void              * user_data );
 #define    OYJL_PATH                   0x08   /**< @brief  flag to obtain only path */
 #define    OYJL_KEY                    0x10   /**< @brief  flat to obtain only keys */
 #define    OYJL_NO_ALLOC               0x800  /**< @brief  avoid malloc for oyjlOBJECT_JSON */
@@ -282,17 +314,28 @@ int        oyjlTreeSetIntF           ( oyjl_val            root,
                                        long long           value,
                                        const char        * format,
                                                            ... );
+#define    OYJL_NESTED                 0x1000 /**< @brief  keep objects and arrays in oyjlTreeSerialise() */
 oyjl_val   oyjlTreeSerialise         ( oyjl_val            v,
                                        int                 flags,
                                        int               * size );
 oyjl_val   oyjlTreeDeSerialise       ( oyjl_val            v,
                                        int                 flags,
                                        int                 size );
+int        oyjlTreeSerialiseToFile   ( oyjl_val            v,
+                                       int                 flags,
+                                       const char        * filename );
+#define    OYJL_VERIFY                 0x2000000 /**< @brief  compare the checksum in oyjlTreeMapFile() */
+oyjl_val   oyjlTreeMapFile           ( const char        * filename,
+                                       int                 flags,
+                                       int               * size );
+void       oyjlTreeUnmapFile         ( oyjl_val            v );
 char *     oyjlValueText             ( oyjl_val            v,
                                        void*             (*alloc)(size_t));
 int        oyjlValueCount            ( oyjl_val            v );
 oyjl_val   oyjlValuePosGet           ( oyjl_val            v,
                                        int                 pos );
+const char * oyjlValuePosGetKey      ( oyjl_val            v,
+                                       int                 pos );
 int        oyjlValueSetString        ( oyjl_val            v,
                                        const char        * string );
 int        oyjlValueSetDouble        ( oyjl_val            v,
@@ -377,6 +420,7 @@ typedef char*(*oyjlTranslate_f)      ( oyjlTr_s          * context,
 #define OYJL_GETTEXT                   0x400000 /**< @brief use gettext */
 /* Workaround for chaotic key order. Slow. */
 #define OYJL_NO_OPTIMISE               0x800000 /**< @brief skip binary search */
+#define OYJL_MAPPED                    0x1000000 /**< @brief catalog is from oyjlTreeMapFile() */
 oyjlTr_s *     oyjlTr_New            ( const char        * loc,
                                        const char        * domain,
                                        oyjl_val          * catalog,
@@ -533,6 +577,9 @@ const char * oyjlTermColor           ( oyjlTEXTMARK_e      mark,
 const char * oyjlTermColorF          ( oyjlTEXTMARK_e      mark,
                                        const char        * format,
                                        ... );
+int          oyjlTermColorToStr      ( oyjlTEXTMARK_e      mark,
+                                       const char        * text,
+                                       oyjl_str            string );
 const char * oyjlTermColorFromHtml   ( const char        * text,
                                        int                 flags );
 const char * oyjlTermColorToPlain    ( const char        * text );
@@ -580,7 +627,9 @@ typedef enum {
   oyjlOBJECT_UI_HEADER_SECTION = 1936222575, /**< @brief oyjlUiHeaderSection_s */
   oyjlOBJECT_UI = 1769302383,          /**< @brief oyjlUi_s */
   oyjlOBJECT_TR = 1920231791,          /**< @brief oyjlTr_s */
-  oyjlOBJECT_JSON = 1397385583         /**< @brief oyjlNodes_s */
+  oyjlOBJECT_JSON = 1397385583,        /**< @brief oyjlNodes_s */
+  oyjlOBJECT_JSON_TREE = 1414162799,   /**< @brief oyjlNodesTree_s */
+  oyjlOBJECT_JSON_NODE = 1313499503    /**< @brief oyjlNode_s */
 } oyjlOBJECT_e;
 
 /** @brief Type of option */
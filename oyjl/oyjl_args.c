@@ -97,6 +97,28 @@ int * oyjl_debug = &my_debug;
 # endif
 # define OYJL_OBSERVE                   0x200000
 # define OYJL_NO_OPTIMISE               0x800000
+# ifndef oyjlAtomicAdd_m
+#  if defined(__GNUC__) || defined(__clang__)
+#   define oyjlAtomicAdd_m( var, n )     __atomic_add_fetch( &(var), n, __ATOMIC_SEQ_CST )
+#   define oyjlAtomicLock_m( lock )      while(__atomic_test_and_set( &(lock), __ATOMIC_ACQUIRE ))
+#   define oyjlAtomicUnlock_m( lock )    __atomic_clear( &(lock), __ATOMIC_RELEASE )
+#  elif defined(_MSC_VER)
+#   include <intrin.h>
+#   define oyjlAtomicAdd_m( var, n )     (_InterlockedExchangeAdd( (volatile long *)&(var), n ) + (n))
+#   define oyjlAtomicLock_m( lock )      while(_InterlockedExchange8( &(lock), 1 ))
+#   define oyjlAtomicUnlock_m( lock )    _InterlockedExchange8( &(lock), 0 )
+#  elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
+#   include <stdatomic.h>
+#   define oyjlAtomicAdd_m( var, n )     (atomic_fetch_add( (_Atomic long *)&(var), n ) + (n))
+#   define oyjlAtomicLock_m( lock )      while(atomic_exchange_explicit( (_Atomic char *)&(lock), 1, memory_order_acquire ))
+#   define oyjlAtomicUnlock_m( lock )    atomic_store_explicit( (_Atomic char *)&(lock), 0, memory_order_release )
+#  else
+#   warning "no atomic operations known: use oyjl_args.c from one thread only"
+#   define oyjlAtomicAdd_m( var, n )     ((var) += (n))
+#   define oyjlAtomicLock_m( lock )      ((lock) = 1)
+#   define oyjlAtomicUnlock_m( lock )    ((lock) = 0)
+#  endif
+# endif
 
 # ifndef OYJL_DBG_FORMAT
 #  if defined(__GNUC__)
@@ -1658,31 +1680,38 @@ static int oyjlTermColorCheck_( )
 #define OYJL_FORCE_COLORTERM           0x01
 #define OYJL_FORCE_NO_COLORTERM        0x04
 #endif
+/* computed once under a lock; 0x100 marks the published result */
 int oyjlTermColorInit_( int flags )
 {
-  int color_env = 0;
-  static int colorterm_init = 0;
-  static const char * oyjl_colorterm = NULL;
-  static int truecolor = 0,
-             color = 0;
-  if(!colorterm_init)
+  static long colorterm_env = 0;
+  static char colorterm_lock = 0;
+  long color_env = oyjlAtomicAdd_m( colorterm_env, 0 );
+
+  if(!color_env)
   {
-    colorterm_init = 1;
-    oyjl_colorterm = getenv("COLORTERM");
-    color = oyjl_colorterm != NULL ? 1 : 0;
-    if(!oyjl_colorterm) oyjl_colorterm = getenv("TERM");
-    truecolor = oyjl_colorterm && strcmp(oyjl_colorterm,"truecolor") == 0;
-    if(!oyjlTermColorCheck_())
-      truecolor = color = 0;
-    if( getenv("FORCE_COLORTERM") || flags & OYJL_FORCE_COLORTERM )
-      truecolor = color = 1;
-    if( getenv("FORCE_NO_COLORTERM") || flags & OYJL_FORCE_NO_COLORTERM )
-      truecolor = color = 0;
-    if(flags & OYJL_OBSERVE)
-      fprintf(stdout, "color: %d truecolor: %d oyjl_colorterm: %s\n", color, truecolor, oyjl_colorterm );
+    oyjlAtomicLock_m( colorterm_lock );
+    color_env = oyjlAtomicAdd_m( colorterm_env, 0 );
+    if(!color_env)
+    {
+      const char * oyjl_colorterm = getenv("COLORTERM");
+      int color = oyjl_colorterm != NULL ? 1 : 0,
+          truecolor;
+      if(!oyjl_colorterm) oyjl_colorterm = getenv("TERM");
+      truecolor = oyjl_colorterm && strcmp(oyjl_colorterm,"truecolor") == 0;
+      if(!oyjlTermColorCheck_())
+        truecolor = color = 0;
+      if( getenv("FORCE_COLORTERM") || flags & OYJL_FORCE_COLORTERM )
+        truecolor = color = 1;
+      if( getenv("FORCE_NO_COLORTERM") || flags & OYJL_FORCE_NO_COLORTERM )
+        truecolor = color = 0;
+      if(flags & OYJL_OBSERVE)
+        fprintf(stdout, "color: %d truecolor: %d oyjl_colorterm: %s\n", color, truecolor, oyjl_colorterm );
+      color_env = 0x100 | (color ? 0x01 : 0x00) | (truecolor ? 0x02 : 0x00);
+      oyjlAtomicAdd_m( colorterm_env, color_env );
+    }
+    oyjlAtomicUnlock_m( colorterm_lock );
   }
-  color_env = (color ? 0x01 : 0x00) | (truecolor ? 0x02 : 0x00);
-  return color_env;
+  return (int)(color_env & 0x03);
 }
 
 #ifndef OYJL_CTEND
@@ -1700,32 +1729,81 @@ int oyjlTermColorInit_( int flags )
 /* switch back */
 #define OYJL_CTEND "\033[0m"
 #endif
-const char * oyjlTermColor( oyjlTEXTMARK_e rgb, const char * text) {
-  int len = 0;
-  static char t[256];
+/* start and end sequences of mark for the current terminal */
+static void oyjlTermColorMarks_      ( oyjlTEXTMARK_e      rgb,
+                                       const char       ** start,
+                                       const char       ** end )
+{
   int color_env = oyjlTermColorInit_( *oyjl_debug > 1?OYJL_OBSERVE:0 ),
       color = color_env & 0x01,
       truecolor = color_env & 0x02;
+
+  *start = *end = "";
+  if(!(color || truecolor))
+    return;
+
+  switch(rgb)
+  {
+    case oyjlNO_MARK: return;
+    case oyjlRED: *start = truecolor ? OYJL_RED_TC : OYJL_RED_B; break;
+    case oyjlGREEN: *start = truecolor ? OYJL_GREEN_TC : OYJL_GREEN_B; break;
+    case oyjlBLUE: *start = truecolor ? OYJL_BLUE_TC : OYJL_BLUE_B; break;
+    case oyjlBOLD: *start = OYJL_BOLD; break;
+    case oyjlITALIC: *start = OYJL_ITALIC; break;
+    case oyjlUNDERLINE: *start = OYJL_UNDERLINE; break;
+  }
+  *end = OYJL_CTEND;
+}
+/** @brief mark text for the terminal
+ *
+ *  The result lives in a static buffer until the next call. Text of 200
+ *  bytes and more is returned unmarked. Use oyjlTermColorToStr() for
+ *  concurrent or nested use.
+ */
+const char * oyjlTermColor( oyjlTEXTMARK_e rgb, const char * text) {
+  static char t[256];
+  const char * start, * end;
   if(!text)
     return "---";
 
-  len = strlen(text);
-  if(len < 200)
+  if(strlen(text) < 200)
   {
-    switch(rgb)
-    {
-      case oyjlNO_MARK: sprintf( t, "%s", text ); break;
-      case oyjlRED: sprintf( t, "%s%s%s", truecolor ? OYJL_RED_TC : color ? OYJL_RED_B : "", text, truecolor || color ? OYJL_CTEND : "" ); break;
-      case oyjlGREEN: sprintf( t, "%s%s%s", truecolor ? OYJL_GREEN_TC : color ? OYJL_GREEN_B : "", text, truecolor || color ? OYJL_CTEND : "" ); break;
-      case oyjlBLUE: sprintf( t, "%s%s%s", truecolor ? OYJL_BLUE_TC : color ? OYJL_BLUE_B : "", text, truecolor || color ? OYJL_CTEND : "" ); break;
-      case oyjlBOLD: sprintf( t, "%s%s%s", truecolor || color ? OYJL_BOLD : "", text, truecolor || color ? OYJL_CTEND : "" ); break;
-      case oyjlITALIC: sprintf( t, "%s%s%s", truecolor || color ? OYJL_ITALIC : "", text, truecolor || color ? OYJL_CTEND : "" ); break;
-      case oyjlUNDERLINE: sprintf( t, "%s%s%s", truecolor || color ? OYJL_UNDERLINE : "", text, truecolor || color ? OYJL_CTEND : "" ); break;
-    }
+    oyjlTermColorMarks_( rgb, &start, &end );
+    sprintf( t, "%s%s%s", start, text, end );
     return t;
   } else
     return text;
 }
+/** @brief append marked text to string
+ *
+ *  Thread safe variant of oyjlTermColor() without length limit.
+ *
+ *  @param         mark                the text mark
+ *  @param         text                the text; NULL is written as "---"
+ *  @param         string              the string to append to
+ *  @return                            0 - success, otherwise error
+ *
+ *  @version Oyjl: 1.0.0
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyjl: 1.0.0)
+ */
+int          oyjlTermColorToStr      ( oyjlTEXTMARK_e      mark,
+                                       const char        * text,
+                                       oyjl_str            string )
+{
+  const char * start, * end;
+  int error;
+  if(!string)
+    return 1;
+  if(!text)
+    return oyjlStr_AppendN( string, "---", 3 );
+
+  oyjlTermColorMarks_( mark, &start, &end );
+  error = oyjlStr_AppendN( string, start, strlen(start) );
+  if(!error) error = oyjlStr_AppendN( string, text, strlen(text) );
+  if(!error) error = oyjlStr_AppendN( string, end, strlen(end) );
+  return error;
+}
 const char * oyjlTermColorF( oyjlTEXTMARK_e rgb, const char * format, ...)
 {
   char * text = NULL;
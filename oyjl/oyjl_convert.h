@@ -0,0 +1,368 @@
+/** @file oyjl_convert.h
+ *
+ *  oyjl - file format conversion driver
+ *
+ *  @par Copyright:
+ *            2026 (C) Kai-Uwe Behrmann
+ *
+ *  @brief    shared main() for the xml2json and yaml2json tools
+ *  @internal
+ *  @author   Kai-Uwe Behrmann <ku.b@gmx.de>
+ *  @par License:
+ *            MIT <http://www.opensource.org/licenses/mit-license.php>
+ *  @since    2026/10/19
+ *
+ *  Without -o each file is converted in turn and printed to stdout.
+ *  With -o DIR the input files and the matching files inside input
+ *  directories are each written to DIR/name.json. Inputs with the same
+ *  name.json are reported and nothing is written. A pool of worker
+ *  processes takes the next file from a shared counter, so a batch is
+ *  bounded by cores and not by process startup. Processes are used
+ *  instead of threads, as the parsers touch process wide state like
+ *  LC_NUMERIC.
+ */
+
+#ifndef OYJL_CONVERT_H
+#define OYJL_CONVERT_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#if !defined(_WIN32)
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+#else
+#include <direct.h>
+#endif
+
+#include "oyjl.h"
+#include "oyjl_tree_internal.h" /* oyjlAtomicAdd_m() */
+
+typedef oyjl_val (*oyjlConvertParse_f)(const char        * text,
+                                       int                 flags,
+                                       char              * error_buffer,
+                                       size_t              error_buffer_size );
+
+typedef struct {
+  char            ** files;
+  int                n;
+} oyjlConvertFiles_s;
+
+static void oyjlConvertAdd_          ( oyjlConvertFiles_s* list,
+                                       char              * file )
+{
+  char ** files = realloc( list->files, (list->n + 1) * sizeof(char*) );
+  if(!files) { free(file); return; }
+  list->files = files;
+  list->files[list->n++] = file;
+}
+
+static int  oyjlConvertHasExt_       ( const char        * name,
+                                       const char       ** exts )
+{
+  const char * dot = strrchr( name, '.' );
+  int i;
+  if(!dot) return 0;
+  for(i = 0; exts[i]; ++i)
+    if(strcmp( dot + 1, exts[i] ) == 0)
+      return 1;
+  return 0;
+}
+
+/* expand a directory to its files with a matching extension */
+static void oyjlConvertCollect_      ( oyjlConvertFiles_s* list,
+                                       const char        * name,
+                                       const char       ** exts )
+{
+  struct stat st;
+#if !defined(_WIN32)
+  DIR * dir;
+  struct dirent * entry;
+
+  if(stat( name, &st ) == 0 && S_ISDIR( st.st_mode ) && (dir = opendir( name )) != NULL)
+  {
+    while((entry = readdir( dir )) != NULL)
+    {
+      char * file = NULL;
+      if(entry->d_name[0] == '.' || !oyjlConvertHasExt_( entry->d_name, exts ))
+        continue;
+      oyjlStringAdd( &file, 0,0, "%s/%s", name, entry->d_name );
+      if(file && stat( file, &st ) == 0 && S_ISREG( st.st_mode ))
+        oyjlConvertAdd_( list, file );
+      else if(file)
+        free( file );
+    }
+    closedir( dir );
+    return;
+  }
+#else
+  (void)st; (void)exts;
+#endif
+  oyjlConvertAdd_( list, oyjlStringCopy( name, 0 ) );
+}
+
+/* DIR/name.json from path/name.ext */
+static char * oyjlConvertOutName_    ( const char        * out_dir,
+                                       const char        * in )
+{
+  const char * base = strrchr( in, '/' ),
+             * dot;
+  char * out = NULL;
+  base = base ? base + 1 : in;
+  dot = strrchr( base, '.' );
+  oyjlStringAdd( &out, 0,0, "%s/%.*s.json", out_dir, dot ? (int)(dot - base) : (int)strlen(base), base );
+  return out;
+}
+
+typedef struct {
+  char             * out;
+  const char       * in;
+} oyjlConvertName_s;
+
+static int  oyjlConvertNameCmp_      ( const void        * a,
+                                       const void        * b )
+{
+  return strcmp( ((const oyjlConvertName_s*)a)->out, ((const oyjlConvertName_s*)b)->out );
+}
+
+/* inputs sharing a base name, like a/x.xml and b/x.xml or x.yaml and
+ * x.yml, would overwrite each others DIR/x.json; return their count */
+static int  oyjlConvertCollisions_   ( oyjlConvertFiles_s* list,
+                                       const char        * out_dir )
+{
+  oyjlConvertName_s * names;
+  int i, error = 0;
+
+  if(list->n < 2) return 0;
+  names = calloc( list->n, sizeof(oyjlConvertName_s) );
+  if(!names) return 1;
+  for(i = 0; i < list->n; ++i)
+  {
+    names[i].out = oyjlConvertOutName_( out_dir, list->files[i] );
+    names[i].in = list->files[i];
+    if(!names[i].out) ++error;
+  }
+  if(!error)
+  {
+    qsort( names, list->n, sizeof(oyjlConvertName_s), oyjlConvertNameCmp_ );
+    for(i = 1; i < list->n; ++i)
+      if(strcmp( names[i-1].out, names[i].out ) == 0)
+      {
+        fprintf( stderr, "%s: %s %s -> %s\n", names[i].in, "same output as", names[i-1].in, names[i].out );
+        ++error;
+      }
+  }
+  for(i = 0; i < list->n; ++i)
+    if(names[i].out) free( names[i].out );
+  free( names );
+  return error;
+}
+
+/* convert one file; print to stdout without out_dir; 0 - success */
+static int  oyjlConvertFile_         ( const char        * in,
+                                       const char        * out_dir,
+                                       oyjlConvertParse_f  parse,
+                                       int                 flags )
+{
+  char error_buffer[256] = {0};
+  char * text = NULL, * out = NULL;
+  oyjl_val root;
+  int size = 0, error = 0;
+  FILE * fp;
+
+  if(strcmp( in, "-" ) == 0)
+    text = oyjlReadFileStreamToMem( stdin, &size );
+  else
+    text = oyjlReadFile( in, &size );
+  if(!text)
+  {
+    fprintf( stderr, "%s: %s\n", in, "could not be read" );
+    return 1;
+  }
+
+  root = parse( text, flags, error_buffer, sizeof(error_buffer) );
+  free( text );
+  if(!root)
+  {
+    fprintf( stderr, "%s: %s\n", in, error_buffer[0] ? error_buffer : "parsing failed" );
+    return 1;
+  }
+
+  if(out_dir)
+  {
+    out = oyjlConvertOutName_( out_dir, in );
+    fp = out ? fopen( out, "wb" ) : NULL;
+  } else
+    fp = stdout;
+
+  if(!fp)
+  {
+    fprintf( stderr, "%s: %s %s\n", in, "could not write", out ? out : "" );
+    error = 1;
+  }
+  else
+  {
+    /* stream, without a second copy of the document in memory */
+    error = oyjlTreeWriteJson( root, OYJL_NO_MARKUP, oyjlWriteToFILE, fp );
+    if(!error && fputc( '\n', fp ) == EOF)
+      error = 1;
+    if(fp != stdout && fclose( fp ) != 0)
+      error = 1;
+    if(error)
+      fprintf( stderr, "%s: %s %s\n", in, "could not write", out ? out : "stdout" );
+  }
+
+  oyjlTreeFree( root );
+  if(out) free( out );
+  return error;
+}
+
+static int  oyjlConvertJobs_         ( const char        * arg )
+{
+  int jobs = arg ? atoi( arg ) : 0;
+#if !defined(_WIN32) && defined(_SC_NPROCESSORS_ONLN)
+  if(jobs <= 0)
+    jobs = (int) sysconf( _SC_NPROCESSORS_ONLN );
+#endif
+  return jobs > 0 ? jobs : 1;
+}
+
+/* run the file list through jobs worker processes; return the number of failed workers or files */
+static int  oyjlConvertBatch_        ( oyjlConvertFiles_s* list,
+                                       const char        * out_dir,
+                                       oyjlConvertParse_f  parse,
+                                       int                 flags,
+                                       int                 jobs )
+{
+  int i, error = 0;
+#if !defined(_WIN32) && !defined(OYJL_NO_ATOMICS)
+  long * next;
+  pid_t * pids;
+
+  if(jobs > list->n)
+    jobs = list->n;
+  if(jobs > 1 &&
+     (next = mmap( NULL, sizeof(long), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0 )) != MAP_FAILED)
+  {
+    pids = calloc( jobs, sizeof(pid_t) );
+    *next = 0;
+    fflush( stdout );
+    fflush( stderr );
+    for(i = 0; pids && i < jobs; ++i)
+    {
+      pids[i] = fork();
+      if(pids[i] == 0)
+      {
+        int n, failed = 0;
+        while((n = oyjlAtomicAdd_m( *next, 1 ) - 1) < list->n)
+          failed += oyjlConvertFile_( list->files[n], out_dir, parse, flags );
+        _exit( failed ? 1 : 0 );
+      }
+      if(pids[i] < 0)
+        break;
+    }
+    /* less workers than asked for is fine, as long as one runs */
+    if(pids)
+    {
+      jobs = i;
+      for(i = 0; i < jobs; ++i)
+      {
+        int status = 0;
+        if(waitpid( pids[i], &status, 0 ) < 0 || !WIFEXITED( status ) || WEXITSTATUS( status ) != 0)
+          ++error;
+      }
+      free( pids );
+    }
+    /* process what no worker picked up, e.g. after fork() failed everywhere */
+    while((i = oyjlAtomicAdd_m( *next, 1 ) - 1) < list->n)
+      error += oyjlConvertFile_( list->files[i], out_dir, parse, flags );
+    munmap( next, sizeof(long) );
+    return error;
+  }
+#else
+  (void)jobs;
+#endif
+
+  for(i = 0; i < list->n; ++i)
+    error += oyjlConvertFile_( list->files[i], out_dir, parse, flags );
+  return error;
+}
+
+static int  oyjlConvertMain_         ( int                 argc,
+                                       char             ** argv,
+                                       oyjlConvertParse_f  parse,
+                                       const char       ** exts,
+                                       int                 flags )
+{
+  oyjlConvertFiles_s list = { NULL, 0 };
+  const char * out_dir = NULL, * jobs = NULL;
+  int i, error = 0;
+
+  for(i = 1; i < argc && argv[i][0] == '-' && argv[i][1]; ++i)
+  {
+    if(strcmp( argv[i], "-n" ) == 0)
+    {
+      fprintf( stderr, "skipping number detection\n" );
+      flags &= ~OYJL_NUMBER_DETECTION;
+    }
+    else if(strcmp( argv[i], "-o" ) == 0 && i + 1 < argc)
+      out_dir = argv[++i];
+    else if(strcmp( argv[i], "-j" ) == 0 && i + 1 < argc)
+      jobs = argv[++i];
+    else
+      break;
+  }
+
+  if(i >= argc)
+  {
+    printf( "Usage: %s [-n (skip number detection)] [-o DIR (write DIR/name.json)] [-j N (worker processes)] file1.%s|dir ...\n", argv[0], exts[0] );
+    return 0;
+  }
+
+  if(out_dir)
+  {
+    struct stat st;
+    if(stat( out_dir, &st ) != 0)
+#if defined(_WIN32)
+      mkdir( out_dir );
+#else
+      mkdir( out_dir, 0755 );
+#endif
+    if(stat( out_dir, &st ) != 0 || !S_ISDIR( st.st_mode ))
+    {
+      fprintf( stderr, "%s: %s\n", out_dir, "no directory" );
+      return 1;
+    }
+  }
+
+  for( ; i < argc; ++i)
+  {
+    if(out_dir)
+      oyjlConvertCollect_( &list, argv[i], exts );
+    else
+      oyjlConvertAdd_( &list, oyjlStringCopy( argv[i], 0 ) );
+  }
+
+  /* fail before writing anything */
+  if(out_dir)
+    error = oyjlConvertCollisions_( &list, out_dir );
+  /* stdout keeps the order of the arguments */
+  if(!error)
+    error = oyjlConvertBatch_( &list, out_dir, parse, flags, out_dir ? oyjlConvertJobs_( jobs ) : 1 );
+
+  for(i = 0; i < list.n; ++i)
+    free( list.files[i] );
+  if(list.files) free( list.files );
+
+  return error ? 1 : 0;
+}
+
+#endif /* OYJL_CONVERT_H */
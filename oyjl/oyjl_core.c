@@ -338,23 +338,26 @@ int          oyjlMessageFunc         ( int/*oyjlMSG_e*/    error_code,
 {
   char * text = NULL;
   int error = 0;
-  const char * status_text = NULL;
+  oyjl_str status = NULL;
 
   OYJL_CREATE_VA_STRING(format, text, malloc, return 1)
 
-  if(error_code == oyjlMSG_INFO) status_text = oyjlTermColor(oyjlGREEN,"Info: ");
-  if(error_code == oyjlMSG_CLIENT_CANCELED) status_text = oyjlTermColor(oyjlBLUE,"Client Canceled: ");
-  if(error_code == oyjlMSG_INSUFFICIENT_DATA) status_text = oyjlTermColor(oyjlRED,"Insufficient data: ");
-  if(error_code == oyjlMSG_ERROR) status_text = oyjlTermColor(oyjlRED,_("Usage Error:"));
-  if(error_code == oyjlMSG_PROGRAM_ERROR) status_text = oyjlTermColor(oyjlRED,_("Program Error:"));
+  status = oyjlStr_New( 10, 0,0 );
 
-  if(status_text)
-    fprintf( stderr, "%s ", status_text );
+  if(error_code == oyjlMSG_INFO) oyjlTermColorToStr(oyjlGREEN,"Info: ", status);
+  if(error_code == oyjlMSG_CLIENT_CANCELED) oyjlTermColorToStr(oyjlBLUE,"Client Canceled: ", status);
+  if(error_code == oyjlMSG_INSUFFICIENT_DATA) oyjlTermColorToStr(oyjlRED,"Insufficient data: ", status);
+  if(error_code == oyjlMSG_ERROR) oyjlTermColorToStr(oyjlRED,_("Usage Error:"), status);
+  if(error_code == oyjlMSG_PROGRAM_ERROR) oyjlTermColorToStr(oyjlRED,_("Program Error:"), status);
+
+  if(oyjlStr(status)[0])
+    fprintf( stderr, "%s ", oyjlStr(status) );
   if(text)
     fprintf( stderr, "%s\n", text );
   fflush( stderr );
 
   free( text ); text = 0;
+  oyjlStr_Release( &status );
 
   return error;
 }
@@ -1643,6 +1646,13 @@ void       oyjlStr_Clear             ( oyjl_str            string )
   if(s) deAlloc(s);
 }
 
+/* length of the text in a string object */
+size_t     oyjlStr_Len_              ( oyjl_str            string )
+{
+  struct oyjl_string_s * str = string;
+  return str ? str->len : 0;
+}
+
 /** @brief   release a string object
  *
  *  All references from previous oyjlStr() calls will be void.
@@ -2513,7 +2523,6 @@ char * oyjl_debug_node_path_ = NULL;
 char * oyjl_debug_node_value_ = NULL;
 extern char * oyjl_term_color_html_;
 void oyjlLibRelease() {
-  int i;
   if(oyjl_nls_path_)
   {
     putenv("NLSPATH=C"); free(oyjl_nls_path_); oyjl_nls_path_ = NULL;
@@ -2524,17 +2533,9 @@ void oyjlLibRelease() {
     dlclose(oyjl_args_render_lib_); oyjl_args_render_lib_ = NULL; oyjl_args_render_init_ = 0;
   }
 #endif
-  if(oyjl_tr_context_)
-  {
-    i = 0;
-    while(oyjl_tr_context_[i])
-    {
-      oyjlTr_Release( &oyjl_tr_context_[i] );
-      ++i;
-    }
-    free(oyjl_tr_context_);
-    oyjl_tr_context_ = NULL;
-  }
+  oyjlTrRegistryRelease_( );
+  oyjlNodesViewsRelease_( NULL );
+  oyjlStringInternRelease_( );
   if(oyjl_debug_node_path_)
   {
     free(oyjl_debug_node_path_);
@@ -46,6 +46,11 @@ char **          oyjlCatalogGetLangs_( char             ** paths,
                                        int              ** lang_positions_start );
 int          oyjlTr_GetStart_        ( oyjlTr_s          * context );
 int          oyjlTr_GetEnd_          ( oyjlTr_s          * context );
+struct oyjlTrIndex_s * oyjlTr_GetIndex_( oyjlTr_s        * context );
+const struct oyjlTrState_s * oyjlTr_GetState_( oyjlTr_s  * context );
+struct oyjlTrIndex_s * oyjlTrIndexNew_( oyjl_val           catalog,
+                                       const char        * loc );
+void         oyjlTrIndexRelease_     ( struct oyjlTrIndex_s ** index );
 
 #ifdef __cplusplus
 }
@@ -252,12 +252,14 @@ void oyjlSetDbgPosition( const char * file, int line )
  *  @see TESTS_RUN
  *  @param         prog                test function: oyjlTESTRESULT_e  (*test)(void)
  *  @param         text                name of the test
- *  @param         do_it               enable the test - usually 1
+ *  @param         do_it               enable the test - usually 1;
+ *                                     0 runs the test only, when named
+ *                                     on the command line
  */
 #define TEST_RUN( prog, text, do_it ) \
 oyjlTESTRESULT_e prog(void); \
 { \
-  if(argc > argpos && do_it) { \
+  if(argc > argpos) { \
       for(i = argpos; i < argc; ++i) \
         if(strstr(text, argv[i]) != 0 || \
            atoi(argv[i]) == oyjl_test_number ) \
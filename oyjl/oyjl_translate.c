@@ -16,6 +16,10 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#if !defined(_WIN32)
+#include <unistd.h>
+#include <sys/wait.h>
+#endif
 
 #include "oyjl_version.h"
 #include "oyjl.h"
@@ -23,65 +27,156 @@
 #include "oyjl_i18n.h"
 #include "oyjl_tree_internal.h"
 
+/* growing text buffer, reused for all entries of a .po file */
+typedef struct {
+  char * s;
+  int    len;
+  int    alloc;
+} oyjlPoStr_s;
+
+static void oyjlPoStrAdd_            ( oyjlPoStr_s       * str,
+                                       const char        * text,
+                                       int                 len )
+{
+  if(len <= 0)
+    return;
+  if(str->len + len + 1 > str->alloc)
+  {
+    int alloc = (str->len + len + 1) * 2;
+    char * s = realloc( str->s, alloc );
+    if(!s) return;
+    str->s = s;
+    str->alloc = alloc;
+  }
+  memcpy( &str->s[str->len], text, len );
+  str->len += len;
+  str->s[str->len] = '\000';
+}
+
+/* decode the "quoted" C string literal at text into str; return the position after it */
+static const char * oyjlPoString_    ( const char        * text,
+                                       oyjlPoStr_s       * str )
+{
+  const char * start;
+  while(*text == ' ' || *text == '\t') ++text;
+  if(*text != '"')
+    return text;
+  start = ++text;
+  while(*text && *text != '"' && *text != '\n')
+  {
+    if(*text == '\\' && text[1] && text[1] != '\n')
+    {
+      char c = text[1];
+      if(c == 'n') c = '\n';
+      else if(c == 't') c = '\t';
+      else if(c == 'r') c = '\r';
+      oyjlPoStrAdd_( str, start, text - start );
+      oyjlPoStrAdd_( str, &c, 1 );
+      text += 2;
+      start = text;
+    } else
+      ++text;
+  }
+  oyjlPoStrAdd_( str, start, text - start );
+  return text;
+}
+
+/* append a finished entry to TS/context/message and reset both strings */
+static void oyjlTreePoAdd_           ( oyjl_val            root,
+                                       oyjl_val          * messages,
+                                       oyjlPoStr_s       * msgid,
+                                       oyjlPoStr_s       * msgstr,
+                                       int               * pos,
+                                       int                 verbose )
+{
+  if(msgid->len && msgstr->len && strcmp( msgid->s, msgstr->s ) != 0)
+  {
+    oyjl_val v;
+    if(!*messages)
+      *messages = oyjlTreeGetValue( root, OYJL_CREATE_NEW, "TS/context/message" );
+    v = oyjlTreeGetValueF( *messages, OYJL_CREATE_NEW, "[%d]/source", *pos );
+    oyjlValueSetString( v, msgid->s );
+    v = oyjlTreeGetValueF( *messages, OYJL_CREATE_NEW, "[%d]/translation", *pos );
+    oyjlValueSetString( v, msgstr->s );
+    if(verbose)
+      fprintf(stderr, "[%d]: %s %s\n", *pos, msgid->s, oyjlTermColor(oyjlBOLD,msgstr->s) );
+    ++*pos;
+  }
+  msgid->len = msgstr->len = 0;
+  if(msgid->s) msgid->s[0] = '\000';
+  if(msgstr->s) msgstr->s[0] = '\000';
+}
+
+/* Single pass .po lexer. The current keyword selects the buffer, which
+ * receives the string literals of the following continuation lines.
+ * Obsolete "#~" entries, msgctxt, msgid_plural and msgstr[1..] are skipped. */
 oyjl_val oyjlTreeParsePo             ( const char        * text,
                                        const char        * input OYJL_UNUSED,
                                        int                 verbose )
 {
-  oyjl_val root = NULL;
-  int count = 0, i, pos = 0;
-  char ** blocks = oyjlStringSplit2( text, "\n\n", oyjlRegExpDelimiter, &count, NULL, NULL );
-  if(count)
+  oyjl_val root = NULL, messages = NULL;
+  oyjlPoStr_s msgid = { NULL, 0, 0 },
+              msgstr = { NULL, 0, 0 },
+            * current = NULL;
+  const char * line = text;
+  int pos = 0, have_msgstr = 0;
+
+  if(text && text[0])
     root = oyjlTreeNew("!DOCTYPE TS");
-  fprintf( stderr, "count: %d\n", count );
-  for(i = 0; i < count; ++i)
+
+  while(root && line && *line)
   {
-    const char * block = blocks[i];
-    if(strstr(block, "msgid") && !strstr(block, "~ msgid"))
+    const char * s = line;
+    while(*s == ' ' || *s == '\t') ++s;
+
+    if(*s == '"')
     {
-      const char * msgid = strstr( block, "msgid" );
-      const char * msgstr = strstr( block, "\nmsgstr");
-      char * t = msgid ? oyjlStringCopy(msgid + 5+2, 0) : NULL;
-      char * tr = msgstr ? oyjlStringCopy(msgstr + 7+2, 0) : NULL;
-      char * tmp;
-      if(!(t && t[0] && tr && tr[0]))
-      {
-        if(t) free(t);
-        if(tr) free(tr);
-        continue;
-      }
-      oyjlStringReplace( &t, "\"\n\"", "", NULL,NULL );
-      oyjlStringReplace( &tr, "\"\n\"", "", NULL,NULL );
-      tmp = (char*)oyjlRegExpDelimiter( t, "\"\n", 0 );
-      tmp[0] = '\000';
-      tmp = (char*)oyjlRegExpDelimiter( tr, "\"$", 0 );
-      if(tmp)
-        tmp[0] = '\000';
-      if(!(t[0] && tr[0]) || strcmp(t,tr) == 0)
+      if(current)
+        oyjlPoString_( s, current );
+    }
+    else if(strncmp( s, "msgid_plural", 12 ) == 0)
+      current = NULL;
+    else if(strncmp( s, "msgid", 5 ) == 0 || strncmp( s, "msgctxt", 7 ) == 0)
+    {
+      if(have_msgstr)
+        oyjlTreePoAdd_( root, &messages, &msgid, &msgstr, &pos, verbose );
+      have_msgstr = 0;
+      msgid.len = 0;
+      current = NULL;
+      if(s[3] == 'i')
       {
-        free(t); free(tr);
-        continue;
+        current = &msgid;
+        oyjlPoString_( s + 5, current );
       }
-      oyjlStringReplace( &t, "\\", "", NULL,NULL );
-      oyjlStringReplace( &tr, "\\", "", NULL,NULL );
-      char * new_path = NULL, * new_key = oyjlStringCopy( t, NULL );
-      tmp = oyjlJsonEscape( new_key,  0 );
-      free(new_key); new_key = tmp; tmp = NULL;
-      oyjlTreeSetStringF( root, OYJL_CREATE_NEW, new_key,  "TS/context/message/[%d]/source", pos );
-      if(verbose)
-        fprintf(stderr, "[%d]: %s", i, new_key );
-      tmp = oyjlJsonEscape( tr, 0 );
-      if(tmp)
+    }
+    else if(strncmp( s, "msgstr", 6 ) == 0)
+    {
+      current = NULL;
+      if(s[6] != '[' || strncmp( s + 6, "[0]", 3 ) == 0)
       {
-        oyjlTreeSetStringF( root, OYJL_CREATE_NEW, t != tr ? tmp : "", "TS/context/message/[%d]/translation", pos );
-        if(verbose)
-          fprintf(stderr, " %s\n", oyjlTermColor(oyjlBOLD,tmp) );
-        free(tmp);
+        current = &msgstr;
+        have_msgstr = 1;
+        oyjlPoString_( s + (s[6] == '[' ? 9 : 6), current );
       }
-      free(new_path);
-      ++pos;
     }
+    else /* empty line, comment or obsolete "#~" entry */
+    {
+      if(have_msgstr)
+        oyjlTreePoAdd_( root, &messages, &msgid, &msgstr, &pos, verbose );
+      have_msgstr = 0;
+      current = NULL;
+    }
+
+    line = strchr( s, '\n' );
+    if(line) ++line;
   }
-  oyjlStringListRelease( &blocks, count, free );
+  if(have_msgstr)
+    oyjlTreePoAdd_( root, &messages, &msgid, &msgstr, &pos, verbose );
+
+  if(verbose)
+    fprintf( stderr, "count: %d\n", pos );
+  free( msgid.s );
+  free( msgstr.s );
   return root;
 }
 
@@ -147,6 +242,253 @@ int oyjlStrcmpWrap_ (const void * a_, const void * b_)
   return strcmp(a,b);
 }
 
+/* gettext results of one locale as '\0' terminated source/translation pairs */
+typedef struct {
+  char * s;
+  int    size;
+  int    alloc;
+} oyjlTrPairs_s;
+
+static void oyjlTrPairsAdd_          ( oyjlTrPairs_s     * pairs,
+                                       const char        * t,
+                                       const char        * tr )
+{
+  int tlen = strlen(t) + 1,
+      trlen = strlen(tr) + 1;
+  if(pairs->size + tlen + trlen > pairs->alloc)
+  {
+    int alloc = (pairs->size + tlen + trlen) * 2;
+    char * s = realloc( pairs->s, alloc );
+    if(!s) return;
+    pairs->s = s;
+    pairs->alloc = alloc;
+  }
+  memcpy( &pairs->s[pairs->size], t, tlen );
+  memcpy( &pairs->s[pairs->size + tlen], tr, trlen );
+  pairs->size += tlen + trlen;
+}
+
+/* look up all keys of root in all domains for lang; return 1 for a unknown locale */
+static int  oyjlTranslateAddLang_    ( const char        * lang,
+                                       oyjl_val            root,
+                                       char             ** paths,
+                                       int                 count,
+                                       char             ** list,
+                                       int                 n,
+                                       char             ** domains,
+                                       int                 domains_n,
+                                       const char        * oyjl_domain_path,
+                                       int                 list_empty,
+                                       int                 verbose,
+                                       oyjlTrPairs_s     * pairs )
+{
+  int j, k, l;
+  const char * checklocale = setlocale( LC_MESSAGES, lang );
+  if(*oyjl_debug || checklocale == NULL || verbose)
+    fprintf(stderr, "setlocale(%s) == %s\n", lang, checklocale );
+
+  if(!checklocale)
+    return 1;
+
+  for(k = 0; k < domains_n; ++k)
+  {
+    const char * domain = domains[k],
+               * var = NULL,
+               * dir = NULL;
+
+#ifdef OYJL_USE_GETTEXT
+    var = textdomain( domain );
+    dir = bindtextdomain( domain, oyjl_domain_path );
+    if(verbose)
+    {
+      char * t = NULL;
+      char * language = oyjlLanguage( lang );
+      oyjlStringAdd( &t, 0,0, "%s/%s/LC_MESSAGES/%s.mo", oyjl_domain_path, language, domain );
+      if(oyjlIsFile(t, "r", NULL, 0))
+        fprintf(stderr, "Found translation file: %s\n", t);
+      free(t);
+      free(language);
+    }
+#endif
+
+    if(*oyjl_debug || verbose)
+      fprintf( stderr, "%s = bindtextdomain() to \"%s\"\ntextdomain: %s == %s\n", dir, oyjl_domain_path, domain, var );
+
+    for(j = 0; j < count; ++j)
+    {
+      char * path = paths[j];
+
+      for(l = 0; l < n; ++l)
+      {
+        char * key = list[l];
+
+        if(oyjlPathMatch(path, key, OYJL_PATH_MATCH_LAST_ITEMS ))
+        {
+          const char * t = NULL,
+                     * tr = NULL;
+          oyjl_val v = oyjlTreeGetValue( root, 0, path );
+          if(v)
+            t = OYJL_GET_STRING(v);
+          if(t && t[0])
+#ifdef OYJL_USE_GETTEXT
+            tr = dgettext( domain, t );
+#else
+            tr = t;
+#endif
+          if(verbose)
+            fprintf(stderr, "found:\t key: %s value[%s]: \"%s\"\n", path, domain, tr?tr:"----" );
+          if(tr && (t != tr || list_empty))
+            oyjlTrPairsAdd_( pairs, t, t != tr ? tr : "" );
+        }
+      }
+    }
+  }
+
+  return 0;
+}
+
+/* place pairs below org/freedesktop/oyjl/translations/lang in order */
+static void oyjlTranslateAddMerge_   ( oyjl_val            target,
+                                       const char        * lang,
+                                       oyjlTrPairs_s     * pairs,
+                                       char             ** text )
+{
+  int pos = 0;
+  while(pos < pairs->size)
+  {
+    const char * t = &pairs->s[pos],
+               * tr = t + strlen(t) + 1;
+    char * new_path = NULL, * new_key = oyjlJsonEscape( t, OYJL_KEY | OYJL_NO_INDEX );
+    oyjl_val v;
+    oyjlStringAdd( &new_path, malloc, free, "org/freedesktop/oyjl/translations/%s/%s", lang, new_key );
+    v = oyjlTreeGetValue( target, OYJL_CREATE_NEW, new_path );
+    oyjlValueSetString( v, tr );
+    oyjlStringAdd( text, malloc, free, "%s\n", tr[0] ? tr : t );
+    free(new_path);
+    free(new_key);
+    pos = tr + strlen(tr) + 1 - pairs->s;
+  }
+}
+
+static int  oyjlTranslateAddJobs_    ( const char        * arg )
+{
+  int jobs = arg ? atoi( arg ) : 1;
+#if !defined(_WIN32) && defined(_SC_NPROCESSORS_ONLN)
+  if(jobs <= 0)
+    jobs = (int) sysconf( _SC_NPROCESSORS_ONLN );
+#endif
+  return jobs > 0 ? jobs : 1;
+}
+
+/* translate each locale in its own worker process and merge in locale order;
+ * gettext and setlocale() are process global, so a worker keeps its catalogs */
+static void oyjlTranslateAddLangs_   ( char             ** langs,
+                                       int                 ln,
+                                       int                 jobs,
+                                       oyjl_val            root,
+                                       char             ** paths,
+                                       int                 count,
+                                       char             ** list,
+                                       int                 n,
+                                       char             ** domains,
+                                       int                 domains_n,
+                                       const char        * oyjl_domain_path,
+                                       int                 list_empty,
+                                       int                 verbose,
+                                       oyjl_val            target,
+                                       char             ** text )
+{
+  int i;
+#if !defined(_WIN32)
+  pid_t * pids = jobs > 1 && ln > 1 ? calloc( ln, sizeof(pid_t) ) : NULL;
+  int * fds = pids ? calloc( ln, sizeof(int) ) : NULL;
+  int started = 0;
+
+  if(pids && fds)
+  {
+    fflush( stdout );
+    fflush( stderr );
+    for(i = 0; i < ln; ++i)
+    {
+      oyjlTrPairs_s pairs = { NULL, 0, 0 };
+
+      /* keep up to jobs workers ahead of the merge position */
+      for( ; started < ln && started < i + jobs; ++started)
+      {
+        int fd[2];
+        pids[started] = -1;
+        if(pipe( fd ) != 0)
+          continue;
+        pids[started] = fork();
+        if(pids[started] == 0)
+        {
+          int pos = 0;
+          close( fd[0] );
+          oyjlTranslateAddLang_( langs[started], root, paths, count, list, n, domains, domains_n, oyjl_domain_path, list_empty, verbose, &pairs );
+          while(pos < pairs.size)
+          {
+            ssize_t w = write( fd[1], &pairs.s[pos], pairs.size - pos );
+            if(w <= 0)
+              _exit( 1 );
+            pos += w;
+          }
+          _exit( 0 );
+        }
+        close( fd[1] );
+        if(pids[started] < 0)
+          close( fd[0] );
+        else
+          fds[started] = fd[0];
+      }
+
+      if(pids[i] > 0)
+      {
+        int status = 0;
+        ssize_t r = 0;
+        do
+        {
+          if(pairs.size + 4096 > pairs.alloc)
+          {
+            char * s = realloc( pairs.s, pairs.alloc = (pairs.size + 4096) * 2 );
+            if(!s) break;
+            pairs.s = s;
+          }
+          r = read( fds[i], &pairs.s[pairs.size], pairs.alloc - pairs.size );
+          if(r > 0)
+            pairs.size += r;
+        } while(r > 0);
+        close( fds[i] );
+        if(waitpid( pids[i], &status, 0 ) < 0 || !WIFEXITED( status ) || WEXITSTATUS( status ) != 0)
+        {
+          fprintf( stderr, "%sERROR: worker failed for locale:\t%s\n", oyjlBT(0), langs[i] );
+          pairs.size = 0;
+        }
+      }
+      else /* no worker could be started, e.g. after fork() failed */
+        oyjlTranslateAddLang_( langs[i], root, paths, count, list, n, domains, domains_n, oyjl_domain_path, list_empty, verbose, &pairs );
+
+      oyjlTranslateAddMerge_( target, langs[i], &pairs, text );
+      free( pairs.s );
+    }
+    free( pids );
+    free( fds );
+    return;
+  }
+  if(pids) free( pids );
+  if(fds) free( fds );
+#else
+  (void)jobs;
+#endif
+
+  for(i = 0; i < ln; ++i)
+  {
+    oyjlTrPairs_s pairs = { NULL, 0, 0 };
+    if(oyjlTranslateAddLang_( langs[i], root, paths, count, list, n, domains, domains_n, oyjl_domain_path, list_empty, verbose, &pairs ) == 0)
+      oyjlTranslateAddMerge_( target, langs[i], &pairs, text );
+    free( pairs.s );
+  }
+}
+
 /* This function is called the
  * * first time for GUI generation and then
  * * for executing the tool.
@@ -169,7 +511,8 @@ int myMain( int argc, const char ** argv )
              * locale = NULL,
              * locales = "cs_CZ,de_DE,eo_EO,eu_ES,fr_FR,ru_RU",
              * localedir = OYJL_LOCALEDIR,
-             * domain = OYJL_DOMAIN;
+             * domain = OYJL_DOMAIN,
+             * jobs = NULL;
   char * json = NULL;
   oyjl_val root = NULL,v;
   char * text = NULL;
@@ -195,6 +538,7 @@ int myMain( int argc, const char ** argv )
                                     {"QObject::tr(\\\"", NULL,            NULL,                         NULL},
                                     {NULL,NULL,NULL,NULL}};
   oyjlOptionChoice_s w_choices[] = {{"C",           _("C static char"), NULL,                         NULL},
+                                    {"oiJF",        _("Binary mappable catalog for oyjlTreeMapFile()"), NULL,   NULL},
                                     {NULL,NULL,NULL,NULL}};
   oyjlOptionChoice_s A_choices[] = {{_("Convert JSON to gettext ready C strings"),_("oyjl-translate -e [-v] -i oyjl-ui.json -o result.json -f '_(\"%s\"); ' -k name,description,help"),NULL,                         NULL},
                                     {_("Add gettext translated keys to JSON"),_("oyjl-translate -a -i oyjl-ui.json -o result.json -k name,description,help -d TEXTDOMAIN -p LOCALEDIR -l de_DE,es_ES"),NULL,                         NULL},
@@ -229,6 +573,8 @@ int myMain( int argc, const char ** argv )
         oyjlOPTIONTYPE_CHOICE,   {0},                oyjlSTRING,    {.s=&locales}},
     {"oiwi", 0,                          "n","list-empty",    NULL,     _("List empty"),_("List not translated"),     _("list empty translations too"),NULL,               
         oyjlOPTIONTYPE_NONE,     {0},                oyjlINT,       {.i=&list_empty}},
+    {"oiwi", OYJL_OPTION_FLAG_EDITABLE,  "j","jobs",          NULL,     _("Jobs"),     _("Parallel Locales"),        _("translate locales in up to NUMBER worker processes; 0 uses all processors"),_("NUMBER"),
+        oyjlOPTIONTYPE_CHOICE,   {0},                oyjlSTRING,    {.s=&jobs}},
     {"oiwi", OYJL_OPTION_FLAG_EDITABLE,  "p","localedir",     NULL,     _("Directory"),_("Locale Directory"),        _("locale directory containing the your-locale/LC_MESSAGES/your-textdomain.mo gettext translations"),_("LOCALEDIR"),     
         oyjlOPTIONTYPE_CHOICE,   {0},                oyjlSTRING,    {.s=&localedir}},
     {"oiwi", 0,                          "t","translations-only",NULL,     _("Translations only"),_("Only Translations"),       _("output only translations"),NULL,               
@@ -267,7 +613,7 @@ int myMain( int argc, const char ** argv )
     {"oiwg", 0,     _("Common Options"),_("Set basic parameters"),    NULL,               "",            "",            "i,o"},
     {"oiwg", 0,     _("Extract"),       _("Convert JSON/C to gettext ready C strings"), _("Two input modes are supported. Read Oyjl UI -X=export JSON. Or parse C sources to --function-name defined strings and replace them in --output by --function-name-out. The later is useful for oyjlTr_s, Qt style or other translations."),
                                                                                           "e,k",         "i,o,f,v,function-name,function-name-out",     "e,f,k,function-name,function-name-out"},
-    {"oiwg", 0,     _("Add"),           _("Add gettext translated keys to JSON"), NULL,   "a,d,k",       "i,o,l,p,w,t,n,v",            "a,d,l,p,k,w,t,n"},
+    {"oiwg", 0,     _("Add"),           _("Add gettext translated keys to JSON"), NULL,   "a,d,k",       "i,o,l,p,j,w,t,n,v",          "a,d,l,p,j,k,w,t,n"},
     {"oiwg", 0,     _("Copy"),          _("Copy keys to JSON"),       _("Import translations from other formats without gettext. Supported --input=Qt-xml-format.tr"),"c,locale",           "i,o,n,v",     "c,locale,n"},
     {"oiwg", 0,     _("Misc"),          _("General options"),         NULL,               "h,X,V",       "v",           "h,X,V,v" },/* just show in documentation */
     {"",0,0,0,0,0,0,0}
@@ -363,6 +709,8 @@ int myMain( int argc, const char ** argv )
     {
       int count = 0, i;
       char ** paths = oyjlTreeToPaths( root, 1000000, NULL, 0, &count );
+      /* files and wrapped code need plain text */
+      int plain = (wrap || (output && strcmp(output,"-") != 0 && strcmp(output,"stdout") != 0)) ? OYJL_NO_MARKUP : 0;
       if(verbose)
         fprintf(stderr, "processed:\t\"%s\" %d\n", input, count);
 
@@ -417,7 +765,6 @@ int myMain( int argc, const char ** argv )
         char * oyjl_domain_path = oyjlStringCopy(OYJL_LOCALEDIR, 0);
         char ** list = oyjlStringSplit( key_list, ',', &n, malloc ),
              ** domains = oyjlStringSplit( domain, ',', &domains_n, malloc );
-        char * dir;
         oyjl_val new_translations = NULL;
 
 #ifdef OYJL_USE_GETTEXT
@@ -463,92 +810,13 @@ int myMain( int argc, const char ** argv )
         oyjlStringAdd( &var, 0,0, "NLSPATH=%s", oyjl_domain_path );
         putenv(var); /* Solaris */
 
-        for(i = 0; i < ln; ++i)
-        {
-          char * lang = langs[i];
-          int j, k;
-
-          const char * checklocale = setlocale( LC_MESSAGES, lang );
-          if(*oyjl_debug || checklocale == NULL || verbose)
-            fprintf(stderr, "setlocale(%s) == %s\n", lang, checklocale );
-
-          if(!checklocale)
-            continue;
-
-          for(k = 0; k < domains_n; ++k)
-          {
-            domain = domains[k];
-
-#ifdef OYJL_USE_GETTEXT
-            var = textdomain( domain );
-            dir = bindtextdomain( domain, oyjl_domain_path );
-            if(verbose)
-            {
-              char * t = NULL;
-              char * language = oyjlLanguage( lang );
-              oyjlStringAdd( &t, 0,0, "%s/%s/LC_MESSAGES/%s.mo", oyjl_domain_path, language, domain );
-              if(oyjlIsFile(t, "r", NULL, 0))
-                fprintf(stderr, "Found translation file: %s\n", t);
-              free(t);
-              free(language);
-            }
-#endif
-
-            if(*oyjl_debug || verbose)
-              fprintf( stderr, "%s = bindtextdomain() to \"%s\"\ntextdomain: %s == %s\n", dir, oyjl_domain_path, domain, var );
-
-            for(j = 0; j < count; ++j)
-            {
-              char * path = paths[j];
-
-              int k;
-              for(k = 0; k < n; ++k)
-              {
-                char * key = list[k];
-
-                if(oyjlPathMatch(path, key, OYJL_PATH_MATCH_LAST_ITEMS ))
-                {
-                  const char * t = NULL,
-                             * tr = NULL;
-                  v = oyjlTreeGetValue( root, 0, path );
-                  if(v)
-                    t = OYJL_GET_STRING(v);
-                  if(t && t[0])
-#ifdef OYJL_USE_GETTEXT
-                    tr = dgettext( domain, t );
-#else
-                    tr = t;
-#endif
-                  if(verbose)
-                    fprintf(stderr, "found:\t key: %s value[%s]: \"%s\"\n", path, domain, tr?tr:"----" );
-                  if(t != tr || list_empty)
-                  {
-                    char * new_path = NULL, * new_key = oyjlStringCopy( t, NULL ), * tmp;
-                    tmp = oyjlJsonEscape( new_key, OYJL_KEY | OYJL_NO_INDEX );
-                    free(new_key); new_key = tmp; tmp = NULL;
-                    oyjlStringAdd( &new_path, malloc, free, "org/freedesktop/oyjl/translations/%s/%s", lang, new_key );
-                    v = oyjlTreeGetValue( new_translations?new_translations:root, OYJL_CREATE_NEW, new_path );
-                    tmp = oyjlJsonEscape( tr, 0 );
-                    if(tmp)
-                    {
-                      oyjlValueSetString( v, t != tr ? tr : "" );
-                      free(tmp);
-                    }
-                    oyjlStringAdd( &text, malloc, free, "%s\n", tr );
-                    free(new_path);
-                  }
-                }
-              }
-            }
-          }
-        }
+        oyjlTranslateAddLangs_( langs, ln, oyjlTranslateAddJobs_( jobs ), root, paths, count, list, n, domains, domains_n,
+                                oyjl_domain_path, list_empty, verbose, new_translations?new_translations:root, &text );
 
         if(verbose)
           fprintf(stderr, "found i18n:\n%s", text );
         if(text) free(text);
-        text = NULL;
-        i = 0;
-        oyjlTreeToJson( new_translations?new_translations:root, &i, &text );
+        text = oyjlTreeToText( new_translations?new_translations:root, OYJL_JSON | plain );
 
       } else if(copy)
       {
@@ -614,12 +882,8 @@ int myMain( int argc, const char ** argv )
                 free(new_key); new_key = tmp; tmp = NULL;
                 oyjlStringAdd( &new_path, malloc, free, "org/freedesktop/oyjl/translations/%s/%s", lang, new_key );
                 val = oyjlTreeGetValue( trans, OYJL_CREATE_NEW | OYJL_NO_INDEX, new_path );
-                tmp = oyjlJsonEscape( tr, 0 );
-                if(tmp)
-                {
-                  oyjlValueSetString( val, t != tr ? tmp : "" );
-                  free(tmp);
-                }
+                /* source and translation are both plain; the JSON writer escapes */
+                oyjlValueSetString( val, tr && t != tr ? tr : "" );
                 free(new_path);
               }
             }
@@ -648,10 +912,7 @@ int myMain( int argc, const char ** argv )
         oyjlTreeFree( trans );
         trans = root; root = NULL;
         if(trans)
-        {
-          i = 0;
-          oyjlTreeToJson( trans, &i, &text );
-        }
+          text = oyjlTreeToText( trans, OYJL_JSON | plain );
 
       } else
         for(i = 0; i < count; ++i)
@@ -665,17 +926,31 @@ int myMain( int argc, const char ** argv )
         {
           char * tmp = NULL;
           char * sname;
-          const char * ptext;
+          if(strcmp(wrap,"oiJF") == 0)
+          {
+            /* serialised catalog, which oyjlTr_New() uses in place */
+            oyjl_val catalog;
+            if(!output || strcmp(output,"-") == 0 || strcmp(output,"stdout") == 0)
+            {
+              fprintf( stderr, "%s -w oiJF needs -o FILENAME\n", oyjlTermColor(oyjlRED,_("Usage Error:")) );
+              error = 1;
+              goto clean_main;
+            }
+            catalog = oyjlTreeParse( text, NULL, 0 );
+            error = catalog ? oyjlTreeSerialiseToFile( catalog, verbose ? OYJL_OBSERVE : 0, output ) : 1;
+            if(error)
+              fprintf( stderr, "%sERROR: Could not write: %s\n", oyjlBT(0), output );
+            oyjlTreeFree( catalog );
+            free(text); text = NULL;
+            goto clean_main;
+          }
           if(strcmp(wrap,"C") != 0)
           {
-            fprintf(stderr,"%sERROR: Only -w C is supported.\n", oyjlBT(0));
+            fprintf(stderr,"%sERROR: Only -w C and -w oiJF are supported.\n", oyjlBT(0));
             error = 1;
             goto clean_main;
           }
 
-          ptext = oyjlTermColorToPlain(text);
-          free(text);
-          text = oyjlStringCopy(ptext,0);
           sname = strdup(domain);
           oyjlStringReplace( &text, "\\", "\\\\", NULL,NULL );
           oyjlStringReplace( &text, "\"", "\\\"", NULL,NULL );
@@ -42,6 +42,11 @@
 #include "oyjl.h"
 #include "oyjl_macros.h"
 #include "oyjl_tree_internal.h"
+#ifdef HAVE_POSIX
+#include <fcntl.h>     /* open() */
+#include <sys/mman.h>  /* mmap() */
+#include <sys/stat.h>  /* fstat() */
+#endif
 #ifdef OYJL_HAVE_LOCALE_H
 #include <locale.h>
 #endif
@@ -129,7 +134,7 @@ static void oyjlObjectFree_(oyjl_val v)
     {
         if(v->u.object.keys && v->u.object.keys[i])
         {
-          free((char *) v->u.object.keys[i]);
+          oyjlKeyFree_(v->u.object.keys[i]);
           v->u.object.keys[i] = NULL;
         }
         if(v->u.object.values && v->u.object.values[i])
@@ -190,10 +195,532 @@ oyjl_val oyjlTreeGet(oyjl_val n, const char ** path, oyjl_type type)
 int        oyjlPathTermGetIndex_     ( const char        * term,
                                        int               * index );
 
+typedef struct oyjlXPath_s
+{
+  uint32_t v_offset;                   /* start of v from start of oyjlXPath_s */
+  char * xpath;                        /* OYJL_KEY escaped string. see oyjlTreeToPaths() */
+  /* Only a subset of oyjl_t is allowed.
+   * - The u.string member is a null terminated array of UTF-8 char.
+   * - The u.number.r member is alway NULL. The plain unparsed string is appended.
+   * - oyjl_t_false, oyjl_t_true and oyjl_t_null are compatible */
+  oyjl_val v;
+} oyjlXPath_s;
+
+/* Serialisation of a oyjl_val tree as linear list.
+ *
+ * oyjlXPath_s follow the oyjlNodes_s::offsets
+ * at the oyjlNodes_s::offsets[count].v_offset position. */
+typedef struct oyjlNodes_s
+{
+  char type [8];                       /* place 'oiJS' here for oyjl static Json; [4..7] keep the content stamp */
+  uint32_t count;                      /* number of entries */
+  int32_t flags;
+  /* offset from begin of the oyjlNodes_s::offsets array to a oyjlXPath_s element.
+   * elements can be of type oyjl_t_null, oyjl_t_string, oyjl_t_true, oyjl_t_false or oyjl_t_number.
+   * Nested elements like oyjl_t_array of oyjl_t_object are not allowed. */
+  uint64_t offsets[];                  /* distance from oyjlNodes_s to oyjlXPath_s */
+} oyjlNodes_s;
+
+/* Tree shaped serialisation of a oyjl_val tree.
+ *
+ * The root oyjlNode_s follows directly the oyjlNodesTree_s header.
+ * Keys and strings are deduplicated inside a shared pool at the end.
+ * All offsets are forward distances from the owning oyjlNode_s, so each
+ * node can be used as a oyjl_val handle without knowing the block start. */
+typedef struct oyjlNodesTree_s
+{
+  char type [8];                       /* place 'oiJT' here for oyjl static Json Tree */
+  uint32_t count;                      /* number of oyjlNode_s */
+  int32_t flags;
+  uint64_t size;                       /* size of the whole block */
+  uint64_t pool;                       /* distance from oyjlNodesTree_s to the key and string pool */
+  uint64_t pool_size;
+} oyjlNodesTree_s;
+
+typedef struct oyjlNode_s
+{
+  int32_t magic;                       /* oyjlOBJECT_JSON_NODE 'oiJN' */
+  int32_t type;                        /* oyjl_type */
+  uint32_t len;                        /* members of oyjl_t_object or oyjl_t_array */
+  uint32_t flags;                      /* oyjl_val_s::u::number::flags */
+  /* distance from oyjlNode_s to the payload:
+   * - oyjl_t_string: UTF-8 text in the pool
+   * - oyjl_t_number: oyjlNodeNumber_s
+   * - oyjl_t_array:  uint64_t child offsets[len]
+   * - oyjl_t_object: uint64_t {key, child} offset pairs[len] */
+  uint64_t data;
+} oyjlNode_s;
+
+typedef struct oyjlNodeNumber_s
+{
+  int64_t i;
+  double d;
+  uint64_t r;                          /* distance from oyjlNode_s to the unparsed number in the pool */
+} oyjlNodeNumber_s;
+
+/* obtain the node from a oiJT block or a oiJN handle */
+static const oyjlNode_s * oyjlNodeGet_(oyjl_val            v )
+{
+  if(!v) return NULL;
+  if((long)v->type == oyjlOBJECT_JSON_NODE)
+    return (const oyjlNode_s *)v;
+  if((long)v->type == oyjlOBJECT_JSON_TREE)
+    return (const oyjlNode_s *)((const char*)v + sizeof(oyjlNodesTree_s));
+  return NULL;
+}
+#define oyjlNodeData_m( node ) ((const char*)(node) + (node)->data)
+static const char * oyjlNodeText_    ( const oyjlNode_s  * node )
+{
+  const char * text = NULL;
+  switch(node->type)
+  {
+    case oyjl_t_string:
+      text = oyjlNodeData_m( node );
+      break;
+    case oyjl_t_number:
+      text = (const char*)node + ((const oyjlNodeNumber_s*)oyjlNodeData_m( node ))->r;
+      break;
+    case oyjl_t_true:
+      text = "true";
+      break;
+    case oyjl_t_false:
+      text = "false";
+      break;
+    default:
+      break;
+  }
+  return text;
+}
+
+static uint32_t oyjlNodesChecksum_   ( const char        * block,
+                                       size_t              size )
+{
+  uint32_t hash = 2166136261u;
+  size_t i;
+  for(i = 0; i < size; ++i)
+  {
+    hash ^= (unsigned char)block[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+/* process wide table of interned object keys
+ *
+ * Each oyjlKey_s holds its text and an atomic reference count. The
+ * table is open addressed, so oyjlKeyFree_() can probe it without lock
+ * and compare the key pointer. Keys without a match are free()d. Only
+ * oyjlStringIntern_() takes oyjl_keys_lock_. It replaces the table when
+ * growing, keeps only referenced keys and retires the old table and the
+ * unreferenced keys. They are freed once no oyjlKeyFree_() probes. */
+typedef struct oyjlKey_s
+{
+  struct oyjlKey_s * retired;          /* unlinked; waits for the readers */
+  uint32_t hash;
+  long refs;
+  char text[];
+} oyjlKey_s;
+
+typedef struct oyjlKeys_s
+{
+  size_t size;                         /* power of two */
+  size_t used;                         /* slots taken */
+  struct oyjlKeys_s * retired;
+  oyjlKey_s * slots[];
+} oyjlKeys_s;
+static oyjlKeys_s * oyjl_keys_ = NULL;
+static long oyjl_keys_live_ = 0;       /* keys with references */
+static long oyjl_keys_readers_ = 0;    /* oyjlKeyFree_() calls probing */
+static oyjlKey_s * oyjl_keys_retired_ = NULL;
+static oyjlKeys_s * oyjl_keys_retired_tables_ = NULL;
+static char oyjl_keys_lock_ = 0;
+
+/* call with oyjl_keys_lock_ */
+static void  oyjlKeysRetiredFree_    ( )
+{
+  if(oyjlAtomicAdd_m( oyjl_keys_readers_, 0 ) != 0)
+    return;
+  while(oyjl_keys_retired_)
+  {
+    oyjlKey_s * k = oyjl_keys_retired_;
+    oyjl_keys_retired_ = k->retired;
+    free( k );
+  }
+  while(oyjl_keys_retired_tables_)
+  {
+    oyjlKeys_s * t = oyjl_keys_retired_tables_;
+    oyjl_keys_retired_tables_ = t->retired;
+    free( t );
+  }
+}
+
+/* call with oyjl_keys_lock_; publishes a new table with the referenced keys */
+static int   oyjlKeysGrow_           ( )
+{
+  oyjlKeys_s * old = oyjl_keys_, * keys;
+  size_t size = 256, live = 0, i;
+
+  for(i = 0; old && i < old->size; ++i)
+    if(old->slots[i] && oyjlAtomicAdd_m( old->slots[i]->refs, 0 ) > 0)
+      ++live;
+  while(size < live * 4) size *= 2;
+
+  keys = (oyjlKeys_s*) calloc( 1, sizeof(oyjlKeys_s) + size * sizeof(oyjlKey_s*) );
+  if(!keys) return 1;
+  keys->size = size;
+  for(i = 0; old && i < old->size; ++i)
+  {
+    oyjlKey_s * k = old->slots[i];
+    if(!k)
+      continue;
+    /* only oyjlStringIntern_() raises a count from zero */
+    if(oyjlAtomicAdd_m( k->refs, 0 ) > 0)
+    {
+      size_t h = k->hash & (size - 1);
+      while(keys->slots[h]) h = (h + 1) & (size - 1);
+      keys->slots[h] = k;
+      ++keys->used;
+    } else
+    {
+      k->retired = oyjl_keys_retired_;
+      oyjl_keys_retired_ = k;
+    }
+  }
+
+  oyjlAtomicSet_m( oyjl_keys_, keys );
+  if(old)
+  {
+    old->retired = oyjl_keys_retired_tables_;
+    oyjl_keys_retired_tables_ = old;
+  }
+  return 0;
+}
+
+/** @internal
+ *  @brief obtain a shared copy of text; release with oyjlKeyFree_() */
+char *     oyjlStringIntern_         ( const char        * text,
+                                       size_t              len )
+{
+  uint32_t hash = oyjlNodesChecksum_( text, len );
+  oyjlKeys_s * keys;
+  oyjlKey_s * k;
+  size_t h;
+
+  oyjlAtomicLock_m( oyjl_keys_lock_ );
+  oyjlKeysRetiredFree_();
+  if((!oyjl_keys_ || (oyjl_keys_->used + 1) * 2 > oyjl_keys_->size) && oyjlKeysGrow_())
+  {
+    oyjlAtomicUnlock_m( oyjl_keys_lock_ );
+    return NULL;
+  }
+  keys = oyjl_keys_;
+
+  h = hash & (keys->size - 1);
+  while((k = keys->slots[h]) != NULL)
+  {
+    if(k->hash == hash && memcmp( k->text, text, len ) == 0 && k->text[len] == '\000')
+    {
+      if(oyjlAtomicAdd_m( k->refs, 1 ) == 1)
+        oyjlAtomicAdd_m( oyjl_keys_live_, 1 );
+      oyjlAtomicUnlock_m( oyjl_keys_lock_ );
+      return k->text;
+    }
+    h = (h + 1) & (keys->size - 1);
+  }
+
+  k = (oyjlKey_s*) malloc( sizeof(oyjlKey_s) + len + 1 );
+  if(k)
+  {
+    k->retired = NULL;
+    k->hash = hash;
+    k->refs = 1;
+    memcpy( k->text, text, len );
+    k->text[len] = '\000';
+    oyjlAtomicAdd_m( oyjl_keys_live_, 1 );
+    ++keys->used;
+    oyjlAtomicSet_m( keys->slots[h], k );
+  }
+  oyjlAtomicUnlock_m( oyjl_keys_lock_ );
+
+  return k ? k->text : NULL;
+}
+
+/** @internal
+ *  @brief release a object key from oyjlStringIntern_() or malloc() */
+void       oyjlKeyFree_              ( char              * key )
+{
+  oyjlKeys_s * keys;
+  oyjlKey_s * k = NULL;
+
+  if(!key) return;
+  /* a interned key keeps the count above zero until it is released here */
+  if(!oyjlAtomicAdd_m( oyjl_keys_live_, 0 )) { free( key ); return; }
+
+  oyjlAtomicAdd_m( oyjl_keys_readers_, 1 );
+  keys = (oyjlKeys_s*) oyjlAtomicGet_m( oyjl_keys_ );
+  if(keys)
+  {
+    size_t h = oyjlNodesChecksum_( key, strlen(key) ) & (keys->size - 1), probes;
+    for(probes = 0; probes < keys->size; ++probes)
+    {
+      k = (oyjlKey_s*) oyjlAtomicGet_m( keys->slots[h] );
+      if(!k || k->text == key)
+        break;
+      h = (h + 1) & (keys->size - 1);
+    }
+    if(k && k->text != key)
+      k = NULL;
+  }
+  if(k && oyjlAtomicAdd_m( k->refs, -1 ) == 0)
+    oyjlAtomicAdd_m( oyjl_keys_live_, -1 );
+  oyjlAtomicAdd_m( oyjl_keys_readers_, -1 );
+
+  if(!k)
+    free( key );
+}
+
+/** @internal
+ *  @brief release the table after all interned trees are gone */
+void       oyjlStringInternRelease_  ( )
+{
+  oyjlAtomicLock_m( oyjl_keys_lock_ );
+  if(!oyjlAtomicAdd_m( oyjl_keys_live_, 0 ) && !oyjlAtomicAdd_m( oyjl_keys_readers_, 0 ) && oyjl_keys_)
+  {
+    size_t i;
+    for(i = 0; i < oyjl_keys_->size; ++i)
+      if(oyjl_keys_->slots[i])
+        free( oyjl_keys_->slots[i] );
+    free( oyjl_keys_ );
+    oyjl_keys_ = NULL;
+  }
+  oyjlKeysRetiredFree_();
+  oyjlAtomicUnlock_m( oyjl_keys_lock_ );
+}
+
+/* borrowed oyjl_val_s views into oiJS blocks
+ *
+ * The views point into the block and are valid as long as the block.
+ * A hash index per block turns oyjlTreeGetValue() into a O(1) lookup.
+ * Index and views are built once on first lookup and are read only
+ * afterwards; they are released by oyjlTreeFree() or oyjlTreeUnmapFile()
+ * together with the block. Entries are keyed by address and by the
+ * content stamp from oyjlTreeSerialise(). So a block released with plain
+ * free() does not pass its views to the next block at that address;
+ * that next block replaces the entry. */
+typedef struct oyjlNodesViews_s
+{
+  const oyjlNodes_s * nodes;
+  uint32_t stamp;                      /* oyjlNodesStamp_() of nodes */
+  oyjl_val_s * views;                  /* one borrowed view per leaf */
+  uint32_t * index;                    /* leaf position + 1; 0 for empty */
+  uint32_t index_n;
+} oyjlNodesViews_s;
+/* registry of oyjlNodesViews_s pointers, guarded by oyjl_nodes_views_lock_ */
+static oyjlNodesViews_s ** oyjl_nodes_views_ = NULL;
+static int oyjl_nodes_views_n_ = 0;
+static char oyjl_nodes_views_lock_ = 0;
+
+#define oyjlNodesXPath_m( nodes, i ) ((const char*)(nodes) + (nodes)->offsets[i] + sizeof(uint32_t))
+/* fill the borrowed view for a oiJS leaf */
+static void  oyjlNodesView_          ( const oyjlNodes_s * nodes,
+                                       uint32_t            pos,
+                                       oyjl_val            view )
+{
+  const char * node = (const char*)nodes + nodes->offsets[pos];
+  uint32_t v_offset = *(const uint32_t*)node;
+  const oyjl_val_s * val = (const oyjl_val_s*)(node + v_offset);
+
+  view->type = val->type;
+  switch(val->type)
+  {
+    case oyjl_t_number:
+      view->u.number.i = val->u.number.i;
+      view->u.number.d = val->u.number.d;
+      view->u.number.flags = val->u.number.flags;
+      view->u.number.r = (char*)val + sizeof(oyjl_val_s);
+      break;
+    case oyjl_t_string:
+      view->u.string = (char*)val + sizeof(oyjl_type);
+      break;
+    default: break;
+  }
+}
+
+static void  oyjlNodesViewsFree_     ( oyjlNodesViews_s  * nv )
+{
+  if(!nv) return;
+  if(nv->index) free( nv->index );
+  if(nv->views) free( nv->views );
+  free( nv );
+}
+
+/* build index and views outside of any lock */
+static oyjlNodesViews_s * oyjlNodesViewsNew_( const oyjlNodes_s * nodes )
+{
+  oyjlNodesViews_s * nv = (oyjlNodesViews_s*) calloc( 1, sizeof(oyjlNodesViews_s) );
+  uint32_t n = 16, i;
+
+  if(!nv) return NULL;
+  while(n < nodes->count * 2) n *= 2;
+  nv->nodes = nodes;
+  nv->index = (uint32_t*) calloc( n, sizeof(uint32_t) );
+  nv->views = (oyjl_val_s*) calloc( nodes->count + 1, sizeof(oyjl_val_s) );
+  if(!nv->index || !nv->views)
+  {
+    oyjlNodesViewsFree_( nv );
+    return NULL;
+  }
+  nv->index_n = n;
+
+  for(i = 0; i < nodes->count; ++i)
+  {
+    const char * xpath = oyjlNodesXPath_m( nodes, i );
+    uint32_t h = oyjlNodesChecksum_( xpath, strlen(xpath) ) & (n - 1);
+    while(nv->index[h]) h = (h + 1) & (n - 1);
+    nv->index[h] = i + 1;
+    oyjlNodesView_( nodes, i, &nv->views[i] );
+  }
+
+  return nv;
+}
+
+/* content checksum in type[4..7]; 0 for blocks from older writers */
+static uint32_t oyjlNodesStamp_      ( const oyjlNodes_s * nodes )
+{
+  uint32_t stamp;
+  memcpy( &stamp, &nodes->type[4], sizeof(stamp) );
+  return stamp;
+}
+
+static oyjlNodesViews_s * oyjlNodesViewsFind_( const oyjlNodes_s * nodes,
+                                       uint32_t            stamp )
+{
+  int i;
+  for(i = 0; i < oyjl_nodes_views_n_; ++i)
+    if(oyjl_nodes_views_[i]->nodes == nodes && oyjl_nodes_views_[i]->stamp == stamp)
+      return oyjl_nodes_views_[i];
+  return NULL;
+}
+
+static oyjlNodesViews_s * oyjlNodesViewsGet_( const oyjlNodes_s * nodes )
+{
+  oyjlNodesViews_s * nv, * new_nv, ** list;
+  uint32_t stamp = oyjlNodesStamp_( nodes );
+  int i;
+
+  oyjlAtomicLock_m( oyjl_nodes_views_lock_ );
+  nv = oyjlNodesViewsFind_( nodes, stamp );
+  oyjlAtomicUnlock_m( oyjl_nodes_views_lock_ );
+  if(nv) return nv;
+
+  new_nv = oyjlNodesViewsNew_( nodes );
+  if(!new_nv) return NULL;
+  new_nv->stamp = stamp;
+
+  /* a other thread might have been faster */
+  oyjlAtomicLock_m( oyjl_nodes_views_lock_ );
+  nv = oyjlNodesViewsFind_( nodes, stamp );
+  if(!nv)
+  {
+    /* a entry with a other stamp belongs to a free()d block */
+    for(i = oyjl_nodes_views_n_ - 1; i >= 0; --i)
+      if(oyjl_nodes_views_[i]->nodes == nodes)
+      {
+        oyjlNodesViewsFree_( oyjl_nodes_views_[i] );
+        oyjl_nodes_views_[i] = oyjl_nodes_views_[--oyjl_nodes_views_n_];
+      }
+    list = (oyjlNodesViews_s**) realloc( oyjl_nodes_views_, sizeof(oyjlNodesViews_s*) * (oyjl_nodes_views_n_ + 1) );
+    if(list)
+    {
+      oyjl_nodes_views_ = list;
+      oyjl_nodes_views_[oyjl_nodes_views_n_++] = nv = new_nv;
+      new_nv = NULL;
+    }
+  }
+  oyjlAtomicUnlock_m( oyjl_nodes_views_lock_ );
+  oyjlNodesViewsFree_( new_nv );
+
+  return nv;
+}
+
+/** @internal
+ *  @brief release views of a oiJS block or all views for NULL */
+void         oyjlNodesViewsRelease_  ( oyjl_val            nodes )
+{
+  int i;
+  oyjlAtomicLock_m( oyjl_nodes_views_lock_ );
+  for(i = oyjl_nodes_views_n_ - 1; i >= 0; --i)
+  {
+    oyjlNodesViews_s * nv = oyjl_nodes_views_[i];
+    if(nodes && nv->nodes != (const oyjlNodes_s*)nodes)
+      continue;
+    oyjlNodesViewsFree_( nv );
+    oyjl_nodes_views_[i] = oyjl_nodes_views_[--oyjl_nodes_views_n_];
+  }
+  if(!oyjl_nodes_views_n_ && oyjl_nodes_views_)
+  {
+    free( oyjl_nodes_views_ );
+    oyjl_nodes_views_ = NULL;
+  }
+  oyjlAtomicUnlock_m( oyjl_nodes_views_lock_ );
+}
+
+/* lookup a leaf in a oiJS block; a miss in the index is final */
+static oyjl_val oyjlNodesGetValue_   ( const oyjlNodes_s * nodes,
+                                       const char        * xpath )
+{
+  oyjlNodesViews_s * nv = oyjlNodesViewsGet_( nodes );
+  uint32_t h;
+
+  if(!nv) return NULL;
+
+  h = oyjlNodesChecksum_( xpath, strlen(xpath) ) & (nv->index_n - 1);
+  while(nv->index[h])
+  {
+    uint32_t pos = nv->index[h] - 1;
+    if(strcmp( oyjlNodesXPath_m( nodes, pos ), xpath ) == 0)
+      return &nv->views[pos];
+    h = (h + 1) & (nv->index_n - 1);
+  }
+
+  return NULL;
+}
+
+/* number of distinct first level terms; the leaves are in tree order */
+static int   oyjlNodesCount_         ( const oyjlNodes_s * nodes )
+{
+  int count = 0;
+  uint32_t i;
+  const char * last = NULL;
+  size_t last_len = 0;
+
+  for(i = 0; i < nodes->count; ++i)
+  {
+    const char * xpath = oyjlNodesXPath_m( nodes, i );
+    const char * slash = strchr( xpath, '/' );
+    size_t len = slash ? (size_t)(slash - xpath) : strlen(xpath);
+    if(!last || len != last_len || memcmp( last, xpath, len ) != 0)
+      ++count;
+    last = xpath;
+    last_len = len;
+  }
+
+  return count;
+}
+
 /** @brief get the value as text string with user allocator */
 char * oyjlValueText (oyjl_val v, void*(*alloc)(size_t size))
 {
   char * t = 0, * text = 0;
+  const oyjlNode_s * node = oyjlNodeGet_( v );
+
+  if(node)
+  {
+    const char * node_text = oyjlNodeText_( node );
+    if(node_text)
+      text = oyjlStringCopy( node_text, alloc );
+    return text;
+  }
 
   if(v)
   switch(v->type)
@@ -226,32 +753,6 @@ char * oyjlValueText (oyjl_val v, void*(*alloc)(size_t size))
   return text;
 }
 
-typedef struct oyjlXPath_s
-{
-  uint32_t v_offset;                   /* start of v from start of oyjlXPath_s */
-  char * xpath;                        /* OYJL_KEY escaped string. see oyjlTreeToPaths() */
-  /* Only a subset of oyjl_t is allowed.
-   * - The u.string member is a null terminated array of UTF-8 char.
-   * - The u.number.r member is alway NULL. The plain unparsed string is appended.
-   * - oyjl_t_false, oyjl_t_true and oyjl_t_null are compatible */
-  oyjl_val v;
-} oyjlXPath_s;
-
-/* Serialisation of a oyjl_val tree as linear list.
- *
- * oyjlXPath_s follow the oyjlNodes_s::offsets
- * at the oyjlNodes_s::offsets[count].v_offset position. */
-typedef struct oyjlNodes_s
-{
-  char type [8];                       /* place 'oiJS' here for oyjl static Json */
-  uint32_t count;                      /* number of entries */
-  int32_t flags;
-  /* offset from begin of the oyjlNodes_s::offsets array to a oyjlXPath_s element.
-   * elements can be of type oyjl_t_null, oyjl_t_string, oyjl_t_true, oyjl_t_false or oyjl_t_number.
-   * Nested elements like oyjl_t_array of oyjl_t_object are not allowed. */
-  uint64_t offsets[];                  /* distance from oyjlNodes_s to oyjlXPath_s */
-} oyjlNodes_s;
-
 static void  oyjlTreeFind_           ( oyjl_val            root,
                                        int                 level,
                                        int                 levels,
@@ -393,21 +894,24 @@ char **    oyjlTreeToPaths           ( oyjl_val            root,
     int i;
     oyjlNodes_s * nodes = (oyjlNodes_s *)root;
 
+    oyjlStringListRelease( &terms, n, free );
     n = nodes->count;
     oyjlAllocHelper_m( paths, char*, n + 1, malloc, return NULL );
-    for(i = 0; i < n; ++i)
+    for(i = 0; i < (int)nodes->count; ++i)
     {
       oyjlXPath_s * node = (oyjlXPath_s *)&((char*)nodes)[nodes->offsets[i]];
-      const char * xpath = (const char*)node + sizeof(uint32_t);
+      const char * path = (const char*)node + sizeof(uint32_t);
+      if(xpath && xpath[0] && !oyjlPathMatch( path, xpath, 0 ))
+        continue;
       if(flags & OYJL_OBSERVE)
-        oyjlMessage_p( oyjlMSG_INFO, 0, OYJL_DBG_FORMAT "xpath[%d]: \"%s\"", OYJL_DBG_ARGS, i, xpath );
+        oyjlMessage_p( oyjlMSG_INFO, 0, OYJL_DBG_FORMAT "xpath[%d]: \"%s\"", OYJL_DBG_ARGS, i, path );
       if(flags & OYJL_NO_ALLOC)
-        paths[i] = (char*)xpath;
+        paths[pos++] = (char*)path;
       else
-        paths[i] = oyjlStringCopy( xpath, malloc );
+        paths[pos++] = oyjlStringCopy( path, malloc );
     }
     if(count)
-      *count = n;
+      *count = pos;
     return paths;
   }
 
@@ -457,9 +961,111 @@ static void oyjlJsonIndent_( char ** json, const char * before, int level, const
   *json = njson;
 }
 
-void       oyjlRegExpEscape2_        ( oyjl_str            text );
-void       oyjlNoBracketCb_(const char * text, const char * start, const char * end, const char * search, const char ** replace, void * data OYJL_UNUSED);
+/* append before, level spaces and after to text in bulk */
+static void oyjlStrIndent_           ( oyjl_str            text,
+                                       const char        * before,
+                                       int                 level,
+                                       const char        * after )
+{
+  static const char spaces[] = "                                                                ";
+  int n;
+  if(before) oyjlStr_AppendN( text, before, strlen(before) );
+  while(level > 0)
+  {
+    n = level < (int)sizeof(spaces) - 1 ? level : (int)sizeof(spaces) - 1;
+    oyjlStr_AppendN( text, spaces, n );
+    level -= n;
+  }
+  if(after) oyjlStr_AppendN( text, after, strlen(after) );
+}
+
+/* character classes in oyjl_json_escape_ for oyjlJsonEscape() */
+#define OYJL_ESC_BACKSLASH 0x01
+#define OYJL_ESC_REGEXP    0x02
+#define OYJL_ESC_QUOTE     0x04
+#define OYJL_ESC_CONTROL   0x08
+#define OYJL_ESC_SLASH     0x10
+#define OYJL_ESC_INDEX     0x20
+#define OYJL_ESC_PERCENT   0x40
+static const unsigned char oyjl_json_escape_[256] = {
+  0,0,0,0,0,0,0,0, 8,8,8,0,8,8,0,0,
+  0,0,0,0,0,0,0,0, 0,0,0,8,0,0,0,0,
+  0,0,4,0,2,64,0,0, 2,2,2,2,0,0,2,16,
+  0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,2,
+  0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0, 0,0,0,34,1,0,2,0,
+  0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0, 0,0,0,2,2,0,0,0,
+  0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0
+};
+
+static char oyjlJsonControl_         ( int                 c,
+                                       int                 reverse )
+{
+  static const char * control = "\b\f\n\r\t",
+                    * letter = "bfnrt";
+  const char * from = reverse ? letter : control,
+             * to = reverse ? control : letter;
+  const char * pos = c ? strchr( from, c ) : NULL;
+  return pos ? to[pos - from] : 0;
+}
+
+/* write the escape sequence for t[i] into out and return its length;
+ * with out = NULL only the length is returned */
+static int oyjlJsonEscapeChar_       ( const unsigned char * t,
+                                       size_t              i,
+                                       int                 flags,
+                                       int                 backslashes,
+                                       char              * out )
+{
+  char seq[4];
+  int n = 0;
+  unsigned char c = t[i];
+
+  if(c == '\\')
+  {
+    if(out) memset( out, '\\', backslashes );
+    return backslashes;
+  }
+  else if(c == '[' && flags & OYJL_REGEXP)
+  {
+#ifdef OYJL_HAVE_REGEX_H
+    seq[n++] = '\\'; seq[n++] = '\\';
+#else
+    /* only a preceding back slash forms the "\[" sequence */
+    if(i && t[i-1] == '\\')
+      seq[n++] = '\\';
+#endif
+    seq[n++] = '[';
+  }
+  else if(c == '[')
+  { seq[n++] = '\\'; seq[n++] = '\\'; seq[n++] = '['; }
+  else if(oyjl_json_escape_[c] & (OYJL_ESC_REGEXP | OYJL_ESC_QUOTE))
+  { seq[n++] = '\\'; seq[n++] = c; }
+  else if(c == '\033')
+  { seq[n++] = '%'; seq[n++] = '3'; seq[n++] = '3'; }
+  else if(c == '/')
+  { seq[n++] = '%'; seq[n++] = '3'; seq[n++] = '7'; }
+  else if(oyjl_json_escape_[c] & OYJL_ESC_CONTROL)
+  { seq[n++] = '\\'; seq[n++] = oyjlJsonControl_( c, 0 ); }
+  else
+    seq[n++] = c;
+
+  if(out) memcpy( out, seq, n );
+  return n;
+}
+
 /** @brief Convert strings to pass through JSON
+ *
+ *  The string is scanned once to size the result and once to write it.
+ *  Strings without characters to escape are copied directly.
  *
  *  @param         in                  input string
  *  @param         flags               support filters:
@@ -472,137 +1078,335 @@ void       oyjlNoBracketCb_(const char * text, const char * start, const char *
  *  @return                            the resulting string
  *
  *  @version Oyjl: 1.0.0
- *  @date    2021/09/11
+ *  @date    2026/10/19
  *  @since   2021/09/01 (Oyjl: 1.0.0)
  */
 char *     oyjlJsonEscape            ( const char        * in,
                                        int                 flags )
 {
-  char * out = NULL;
-  const char * t = in;
-  oyjl_str tmp;
+  char * out = NULL, * o;
+  const unsigned char * t = (const unsigned char *) in;
+  int mask = OYJL_ESC_BACKSLASH | OYJL_ESC_CONTROL,
+      backslashes = 2,
+      hits = 0;
+  size_t len = 0, size = 0, i;
   if(!in) return NULL;
 
-  tmp = oyjlStr_New(10,0,0);
-  oyjlStr_AppendN( tmp, t, strlen(t) );
   if(flags & OYJL_REVERSE)
+    mask = OYJL_ESC_BACKSLASH | OYJL_ESC_PERCENT;
+  else
   {
-    if(flags & OYJL_NO_INDEX || flags & OYJL_KEY)
-    {
-      oyjlStr_Replace( tmp, "\\\\[", "[", 0, NULL );
-      oyjlStr_Replace( tmp, "\\[", "[", 0, NULL );
-      oyjlStr_Replace( tmp, "\\]", "]", 0, NULL );
-    }
-    if(!(flags & OYJL_NO_BACKSLASH))
-      oyjlStr_Replace( tmp, "\\\\", "\\", 0, NULL );
-    if(flags & OYJL_QUOTE)
-      oyjlStr_Replace( tmp, "\\\"", "\"", 0, NULL );
-    oyjlStr_Replace( tmp, "\\b", "\b", 0, NULL );
-    oyjlStr_Replace( tmp, "\\f", "\f", 0, NULL );
-    oyjlStr_Replace( tmp, "\\n", "\n", 0, NULL );
-    oyjlStr_Replace( tmp, "\\r", "\r", 0, NULL );
-    oyjlStr_Replace( tmp, "\\t", "\t", 0, NULL );
-    oyjlStr_Replace( tmp, "%33", "\033", 0, NULL );
-    if(flags & OYJL_KEY)
-      oyjlStr_Replace( tmp, "%37", "/", NULL,NULL );
-    /* undo RegExp */
-    oyjlStr_Replace( tmp, "\\.", ".", 0, NULL );
-    oyjlStr_Replace( tmp, "\\^", "^", 0, NULL );
-    oyjlStr_Replace( tmp, "\\$", "$", 0, NULL );
-    oyjlStr_Replace( tmp, "\\*", "*", 0, NULL );
-    oyjlStr_Replace( tmp, "\\+", "+", 0, NULL );
-    oyjlStr_Replace( tmp, "\\?", "?", 0, NULL );
-    oyjlStr_Replace( tmp, "\\(", "(", 0, NULL );
-    oyjlStr_Replace( tmp, "\\)", ")", 0, NULL );
-    oyjlStr_Replace( tmp, "\\{", "{", 0, NULL );
-    oyjlStr_Replace( tmp, "\\|", "|", 0, NULL );
-  } else
-  {
-    if(!(flags & OYJL_NO_BACKSLASH) || !(flags & OYJL_REGEXP))
-      oyjlStr_Replace( tmp, "\\", "\\\\", oyjlNoBracketCb_, NULL );
-    if(flags & OYJL_REGEXP)
-      oyjlRegExpEscape2_( tmp );
     if(flags & OYJL_QUOTE)
-      oyjlStr_Replace( tmp, "\"", "\\\"", 0, NULL );
-    oyjlStr_Replace( tmp, "\b", "\\b", 0, NULL );
-    oyjlStr_Replace( tmp, "\f", "\\f", 0, NULL );
-    oyjlStr_Replace( tmp, "\n", "\\n", 0, NULL );
-    oyjlStr_Replace( tmp, "\r", "\\r", 0, NULL );
-    oyjlStr_Replace( tmp, "\t", "\\t", 0, NULL );
-    oyjlStr_Replace( tmp, "\033", "%33", 0, NULL );
+      mask |= OYJL_ESC_QUOTE;
     if(flags & OYJL_KEY)
-      oyjlStr_Replace( tmp, "/", "%37", NULL,NULL );
+      mask |= OYJL_ESC_SLASH;
+    if(flags & OYJL_REGEXP || flags & OYJL_NO_INDEX || flags & OYJL_KEY)
+      mask |= OYJL_ESC_INDEX;
+    if(flags & OYJL_REGEXP && flags & OYJL_NO_BACKSLASH)
+      backslashes = 1;
+#ifdef OYJL_HAVE_REGEX_H
     if(flags & OYJL_REGEXP)
-      oyjlStr_Replace( tmp, "\\[", "\\\\[", 0, NULL );
-    else if(flags & OYJL_NO_INDEX || flags & OYJL_KEY)
     {
-      oyjlStr_Replace( tmp, "[", "\\\\[", 0, NULL );
-      //oyjlStr_Replace( tmp, "]", "\\\\]", 0, NULL );
+      mask |= OYJL_ESC_REGEXP;
+      backslashes *= 2;
     }
+#endif
   }
-  out = oyjlStr_Pull(tmp); 
-  oyjlStr_Release( &tmp );
-  return out;
+
+  /* size the result; the reverse direction never grows */
+  for(i = 0; t[i]; ++i)
+    if(oyjl_json_escape_[t[i]] & mask)
+    {
+      size += (flags & OYJL_REVERSE) ? 1 : oyjlJsonEscapeChar_( t, i, flags, backslashes, NULL );
+      ++hits;
+    }
+    else
+      ++size;
+  len = i;
+
+  oyjlAllocHelper_m( out, char, size + 1, malloc, return NULL );
+  if(!hits)
+  {
+    memcpy( out, in, len );
+    return out;
+  }
+  o = out;
+
+  if(flags & OYJL_REVERSE)
+  {
+    for(i = 0; i < len; )
+    {
+      if(t[i] == '\\')
+      {
+        /* resolve a run of back slashes together with the following
+         * character in the order, in which the escape sequences are undone */
+        int n = 0, m;
+        unsigned char c;
+        char control = 0;
+        while(t[i+n] == '\\') ++n;
+        c = t[i+n];
+        m = n;
+        if(flags & OYJL_NO_INDEX || flags & OYJL_KEY)
+        {
+          if(c == '[')
+            m = n > 3 ? n - 3 : 0;
+          else if(c == ']')
+            m = n - 1;
+        }
+        if(!(flags & OYJL_NO_BACKSLASH))
+          m = (m + 1) / 2;
+        if(m && ((c == '"' && flags & OYJL_QUOTE) ||
+                 (control = oyjlJsonControl_( c, 1 )) != 0 ||
+                 (c != '[' && oyjl_json_escape_[c] & OYJL_ESC_REGEXP)))
+          --m;
+        memset( o, '\\', m ); o += m;
+        i += n;
+        if(control)
+        {
+          *o++ = control;
+          ++i;
+        }
+      }
+      else if(t[i] == '%' && t[i+1] == '3' && (t[i+2] == '3' || (t[i+2] == '7' && flags & OYJL_KEY)))
+      {
+        *o++ = t[i+2] == '3' ? '\033' : '/';
+        i += 3;
+      }
+      else
+        *o++ = t[i++];
+    }
+  }
+  else
+    for(i = 0; i < len; ++i)
+      if(oyjl_json_escape_[t[i]] & mask)
+        o += oyjlJsonEscapeChar_( t, i, flags, backslashes, o );
+      else
+        *o++ = t[i];
+  *o = '\000';
+
+  return out;
+}
+
+/* append text marked by oyjlTermColorToStr() or plain for OYJL_NO_MARKUP */
+static void oyjlTreeColor_           ( oyjl_str            str,
+                                       oyjlTEXTMARK_e      mark,
+                                       const char        * text,
+                                       int                 flags )
+{
+  if(flags & OYJL_NO_MARKUP)
+  {
+    if(!text) text = "---";
+    oyjlStr_AppendN( str, text, strlen(text) );
+  }
+  else
+    oyjlTermColorToStr( mark, text, str );
+}
+
+/* tree writer state; with write the text is passed on in chunks */
+typedef struct {
+  oyjl_str           text;             /* pending output */
+  int                flags;            /* OYJL_NO_MARKUP */
+  oyjlWrite_f        write;            /* optional sink */
+  void             * user_data;
+  int                error;
+} oyjlWriter_s;
+#define OYJL_WRITE_CHUNK 4096
+
+/* pass the pending text to the sink, once it reaches OYJL_WRITE_CHUNK
+ * or with all */
+static int oyjlWriterFlush_          ( oyjlWriter_s      * w,
+                                       int                 all )
+{
+  size_t len;
+  if(!w->write || w->error)
+    return w->error;
+
+  len = oyjlStr_Len_( w->text );
+  if(len && (all || len >= OYJL_WRITE_CHUNK))
+  {
+    w->error = w->write( oyjlStr( w->text ), len, w->user_data );
+    oyjlStr_Clear( w->text );
+  }
+  return w->error;
 }
 
+int  oyjlTreeToJson21_(oyjl_val v, int * level, oyjlWriter_s * w);
+static int  oyjlTreeToYaml_          ( oyjl_val            v,
+                                       int               * level,
+                                       oyjlWriter_s      * w );
+static int  oyjlTreeToXml_           ( oyjl_val            v,
+                                       int               * level,
+                                       oyjlWriter_s      * w );
 /** @brief convert a C tree into a text string
  *
- *  @see oyjlTreeToJson() oyjlTreeToYaml() oyjlTreeToXml()
+ *  With OYJL_NO_MARKUP the writers emit plain text without any terminal
+ *  markup.
+ *  OYJL_JSON_COMPACT writes JSON without line breaks and indentation,
+ *  e.g. for caches and IPC.
+ *
+ *  @see oyjlTreeToJson() oyjlTreeToYaml() oyjlTreeToXml() oyjlTreeWriteJson()
  */
 char *     oyjlTreeToText            ( oyjl_val            v,
                                        int                 flags )
 {
-  int level = 0;
+  int level = 0, error = 0;
   char * text = NULL;
+  oyjlWriter_s w = { NULL, 0, NULL, NULL, 0 };
+  w.flags = flags;
+
+  w.text = oyjlStr_New( 10, 0,0 );
+  if(flags & OYJL_YAML)
+    error = oyjlTreeToYaml_( v, &level, &w );
+  else if(flags & OYJL_XML)
+    error = oyjlTreeToXml_( v, &level, &w );
+  else
+    oyjlTreeToJson21_( v, &level, &w );
+  if(!error)
+    text = oyjlStr_Pull( w.text );
+  oyjlStr_Release( &w.text );
 
+  return text;
+}
+
+/* stream v in chunks to write */
+static int oyjlTreeWrite_            ( oyjl_val            v,
+                                       int                 flags,
+                                       oyjlWrite_f         write,
+                                       void              * user_data )
+{
+  int level = 0, error;
+  oyjlWriter_s w = { NULL, 0, NULL, NULL, 0 };
+
+  if(!write)
+    return 1;
+
+  w.flags = flags;
+  w.write = write;
+  w.user_data = user_data;
+  w.text = oyjlStr_New( OYJL_WRITE_CHUNK, 0,0 );
   if(flags & OYJL_YAML)
-    oyjlTreeToYaml( v, &level, &text );
+    error = oyjlTreeToYaml_( v, &level, &w );
   else if(flags & OYJL_XML)
-    oyjlTreeToXml( v, &level, &text );
+    error = oyjlTreeToXml_( v, &level, &w );
   else
-    oyjlTreeToJson( v, &level, &text );
+    error = oyjlTreeToJson21_( v, &level, &w );
+  if(!error)
+    oyjlWriterFlush_( &w, 1 );
+  else if(!w.error)
+    w.error = error;
+  oyjlStr_Release( &w.text );
+
+  return w.error;
+}
+
+/** @brief stream a C tree as JSON
+ *
+ *  The text is passed on in chunks of a few kilobytes. So large trees can
+ *  be written without holding the whole document in memory.
+ *
+ *  @param         v                   node
+ *  @param         flags               OYJL_NO_MARKUP for files, OYJL_JSON_COMPACT for minified output
+ *  @param         write               sink for the text; oyjlWriteToFILE(), oyjlWriteToFd() or custom
+ *  @param         user_data           passed to write
+ *  @return                            0 - success, otherwise the first error from write or 1
+ *
+ *  @version Oyjl: 1.0.0
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyjl: 1.0.0)
+ */
+int        oyjlTreeWriteJson         ( oyjl_val            v,
+                                       int                 flags,
+                                       oyjlWrite_f         write,
+                                       void              * user_data )
+{
+  return oyjlTreeWrite_( v, flags & ~(OYJL_YAML | OYJL_XML), write, user_data );
+}
+
+/** @brief stream a C tree as YAML
+ *
+ *  @see oyjlTreeWriteJson()
+ *
+ *  @version Oyjl: 1.0.0
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyjl: 1.0.0)
+ */
+int        oyjlTreeWriteYaml         ( oyjl_val            v,
+                                       int                 flags,
+                                       oyjlWrite_f         write,
+                                       void              * user_data )
+{
+  return oyjlTreeWrite_( v, (flags & ~OYJL_XML) | OYJL_YAML, write, user_data );
+}
+
+/** @brief stream a C tree as XML
+ *
+ *  @see oyjlTreeWriteJson() oyjlTreeToXml()
+ *
+ *  @version Oyjl: 1.0.0
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyjl: 1.0.0)
+ */
+int        oyjlTreeWriteXml          ( oyjl_val            v,
+                                       int                 flags,
+                                       oyjlWrite_f         write,
+                                       void              * user_data )
+{
+  return oyjlTreeWrite_( v, (flags & ~OYJL_YAML) | OYJL_XML, write, user_data );
+}
+
+/** @brief oyjlWrite_f for a FILE pointer as user_data */
+int        oyjlWriteToFILE           ( const char        * text,
+                                       size_t              len,
+                                       void              * user_data )
+{
+  FILE * fp = (FILE*) user_data;
+  if(!fp || fwrite( text, 1, len, fp ) != len)
+    return errno ? errno : 1;
+  return 0;
+}
 
-  if(text && flags & OYJL_NO_MARKUP)
+/** @brief oyjlWrite_f for a pointer to a file descriptor as user_data */
+int        oyjlWriteToFd             ( const char        * text,
+                                       size_t              len,
+                                       void              * user_data )
+{
+  int * fd = (int*) user_data;
+  while(fd && len)
   {
-    const char * t = NULL;
-    t = oyjlTermColorToPlain( text );
-    if(t && t != text)
-    {
-      free(text); text = NULL;
-      text = oyjlStringCopy( t, 0 );
-    }
+    ssize_t n = write( *fd, text, len );
+    if(n < 0 && errno == EINTR)
+      continue;
+    if(n <= 0)
+      return errno ? errno : 1;
+    text += n;
+    len -= n;
   }
-
-  return text;
+  return fd ? 0 : 1;
 }
 
-int  oyjlTreeToJson21_(oyjl_val v, int * level, oyjl_str json)
+int  oyjlTreeToJson21_(oyjl_val v, int * level, oyjlWriter_s * w)
 {
   int error = 0;
-  const char * t;
+  oyjl_str json = w->text;
+  int flags = w->flags;
   if(v)
   switch(v->type)
   {
     case oyjl_t_null:
-         t = oyjlTermColor(oyjlUNDERLINE,"null");
-         oyjlStr_AppendN (json, t, strlen(t)); break;
+         oyjlTreeColor_( json, oyjlUNDERLINE, "null", flags ); break;
          break;
     case oyjl_t_number:
-         t = oyjlTermColor(oyjlBLUE, v->u.number.r);
-         oyjlStr_AppendN (json, t, strlen(t));
+         oyjlTreeColor_( json, oyjlBLUE, v->u.number.r, flags );
          break;
     case oyjl_t_true:
-         t = oyjlTermColor(oyjlGREEN,"true");
-         oyjlStr_AppendN (json, t, strlen(t)); break;
+         oyjlTreeColor_( json, oyjlGREEN, "true", flags ); break;
     case oyjl_t_false:
-         t = oyjlTermColor(oyjlRED,"false");
-         oyjlStr_AppendN (json, t, strlen(t)); break;
+         oyjlTreeColor_( json, oyjlRED, "false", flags ); break;
     case oyjl_t_string:
          {
           char * escaped = oyjlJsonEscape( v->u.string, OYJL_QUOTE | OYJL_NO_BACKSLASH );
-          t = oyjlTermColor(oyjlBOLD,escaped);
           oyjlStr_AppendN( json, "\"", 1 );
-          oyjlStr_AppendN( json, t, strlen(t) );
+          oyjlTreeColor_( json, oyjlBOLD, escaped, flags );
           oyjlStr_AppendN( json, "\"", 1 );
           free( escaped );
          }
@@ -617,12 +1421,13 @@ int  oyjlTreeToJson21_(oyjl_val v, int * level, oyjl_str json)
            *level += 2;
            for(i = 0; i < count; ++i)
            {
-             oyjlTreeToJson21_( v->u.array.values[i], level, json );
+             oyjlTreeToJson21_( v->u.array.values[i], level, w );
              if(count > 1)
              {
                if(i < count - 1)
                  oyjlStr_AppendN( json, ",", 1 );
              }
+             if(oyjlWriterFlush_( w, 0 )) return w->error;
            }
            *level -= 2;
 
@@ -630,7 +1435,7 @@ int  oyjlTreeToJson21_(oyjl_val v, int * level, oyjl_str json)
          } break;
     case oyjl_t_object:
          {
-           int i,j,
+           int i,
                count = v->u.object.len;
 
            oyjlStr_AppendN( json, "{", 1 );
@@ -638,8 +1443,8 @@ int  oyjlTreeToJson21_(oyjl_val v, int * level, oyjl_str json)
            *level += 2;
            for(i = 0; i < count; ++i)
            {
-             oyjlStr_AppendN( json, "\n", 1 );
-             for(j = 0; j < *level; ++j) oyjlStr_AppendN( json, " ", 1 );
+             if(!(flags & OYJL_JSON_COMPACT))
+               oyjlStrIndent_( json, "\n", *level, NULL );
              if(!v->u.object.keys || !v->u.object.keys[i])
              {
                oyjlMessage_p( oyjlMSG_ERROR, 0, OYJL_DBG_FORMAT "missing key", OYJL_DBG_ARGS );
@@ -648,23 +1453,26 @@ int  oyjlTreeToJson21_(oyjl_val v, int * level, oyjl_str json)
              oyjlStr_AppendN( json, "\"", 1 );
              {
               char * escaped = oyjlJsonEscape( v->u.object.keys[i], OYJL_QUOTE | OYJL_NO_BACKSLASH );
-              const char * t = oyjlTermColor(oyjlITALIC,escaped);
-              oyjlStr_AppendN( json, t, strlen(t) );
+              oyjlTreeColor_( json, oyjlITALIC, escaped, flags );
               free( escaped );
              }
-             oyjlStr_AppendN( json, "\": ", 3 );
-             error = oyjlTreeToJson21_( v->u.object.values[i], level, json );
+             if(flags & OYJL_JSON_COMPACT)
+               oyjlStr_AppendN( json, "\":", 2 );
+             else
+               oyjlStr_AppendN( json, "\": ", 3 );
+             error = oyjlTreeToJson21_( v->u.object.values[i], level, w );
              if(error) return error;
              if(count > 1)
              {
                if(i < count - 1)
                  oyjlStr_AppendN( json, ",", 1 );
              }
+             if(oyjlWriterFlush_( w, 0 )) return w->error;
            }
            *level -= 2;
 
-           oyjlStr_AppendN( json, "\n", 1 );
-           for(j = 0; j < *level; ++j) oyjlStr_AppendN( json, " ", 1 );
+           if(!(flags & OYJL_JSON_COMPACT))
+             oyjlStrIndent_( json, "\n", *level, NULL );
            oyjlStr_AppendN( json, "}", 1 );
          }
          break;
@@ -676,17 +1484,18 @@ int  oyjlTreeToJson21_(oyjl_val v, int * level, oyjl_str json)
 }
 /** @brief convert a C tree into a JSON string
  *
- *  @see oyjlTreeParse()
+ *  @see oyjlTreeParse() oyjlTreeToText() oyjlTreeWriteJson()
  */
 void oyjlTreeToJson (oyjl_val v, int * level, char ** json)
 {
-  oyjl_str string = oyjlStr_New(10, 0,0);
-  oyjlTreeToJson21_( v, level, string );
-  if(oyjlStr(string))
-    *json = oyjlStr_Pull(string);
+  oyjlWriter_s w = { NULL, 0, NULL, NULL, 0 };
+  w.text = oyjlStr_New(10, 0,0);
+  oyjlTreeToJson21_( v, level, &w );
+  if(oyjlStr(w.text))
+    *json = oyjlStr_Pull(w.text);
   else
     *json = NULL;
-  oyjlStr_Release( &string );
+  oyjlStr_Release( &w.text );
 }
 
 void oyjlTreeToJson2_ (oyjl_val v, int * level, char ** json)
@@ -788,25 +1597,39 @@ char * oyjlTreePrint (oyjl_val v)
   return json;
 }
 
-/** @brief convert a C tree into a YAML string
- *
- *  @see oyjlTreeParseYaml()
- *
- *  @param         v                   node
- *  @param         level               desired level depth
- *  @param         text                the resulting string
- *
- *  @version Oyranos: 0.9.7
- *  @date    2019/01/01
- *  @since   2019/01/01 (Oyranos: 0.9.7)
- */
-void               oyjlTreeToYaml    ( oyjl_val            v,
+/* append a YAML scalar with quotes and ": " escaped */
+static void oyjlYamlEscape_          ( oyjl_str            text,
+                                       const char        * string )
+{
+  const char * start = string, * t = string;
+  for( ; *t; ++t)
+  {
+    if(*t == '"')
+    {
+      oyjlStr_AppendN( text, start, t - start );
+      oyjlStr_AppendN( text, "\\\"", 2 );
+      start = t + 1;
+    }
+    else if(*t == ':' && t[1] == ' ')
+    {
+      oyjlStr_AppendN( text, start, t - start );
+      oyjlStr_AppendN( text, ":\\ ", 3 );
+      start = t + 2;
+      ++t;
+    }
+  }
+  oyjlStr_AppendN( text, start, t - start );
+}
+
+static int  oyjlTreeToYaml_          ( oyjl_val            v,
                                        int               * level,
-                                       char             ** text)
+                                       oyjlWriter_s      * w )
 {
+  oyjl_str text = w->text;
+  int flags = w->flags, error = 0;
 #define YAML_INDENT " "
   if(*level == 0)
-    oyjlStringAdd( text, 0,0, "---" );
+    oyjlStr_AppendN( text, "---", 3 );
 
   if(v)
   switch(v->type)
@@ -814,20 +1637,27 @@ void               oyjlTreeToYaml    ( oyjl_val            v,
     case oyjl_t_null:
          break;
     case oyjl_t_number:
-         oyjlStringAdd (text, 0,0, " %s", oyjlTermColor(oyjlBLUE,v->u.number.r));
+         oyjlStr_AppendN( text, " ", 1 );
+         oyjlTreeColor_( text, oyjlBLUE, v->u.number.r, flags );
          break;
     case oyjl_t_true:
-         oyjlStringAdd (text, 0,0, " %s", oyjlTermColor(oyjlGREEN,"true")); break;
+         oyjlStr_AppendN( text, " ", 1 );
+         oyjlTreeColor_( text, oyjlGREEN, "true", flags ); break;
     case oyjl_t_false:
-         oyjlStringAdd (text, 0,0, " %s", oyjlTermColor(oyjlRED,"false")); break;
+         oyjlStr_AppendN( text, " ", 1 );
+         oyjlTreeColor_( text, oyjlRED, "false", flags ); break;
     case oyjl_t_string:
+         oyjlStr_AppendN( text, YAML_INDENT, 1 );
+         if(!v->u.string)
+           oyjlStr_AppendN( text, "---", 3 );
+         else if(flags & OYJL_NO_MARKUP)
+           oyjlYamlEscape_( text, v->u.string );
+         else
          {
-          const char * t = v->u.string;
-          char * tmp = oyjlStringCopy(t,malloc);
-          oyjlStringReplace( &tmp, "\"", "\\\"", 0, 0);
-          oyjlStringReplace( &tmp, ": ", ":\\ ", 0, 0);
-          oyjlStringAdd (text, 0,0, YAML_INDENT "%s", oyjlTermColor(oyjlBOLD,tmp));
-          if(tmp) free(tmp);
+          oyjl_str tmp = oyjlStr_New( 10, 0,0 );
+          oyjlYamlEscape_( tmp, v->u.string );
+          oyjlTreeColor_( text, oyjlBOLD, oyjlStr(tmp), flags );
+          oyjlStr_Release( &tmp );
          }
          break;
     case oyjl_t_array:
@@ -837,10 +1667,12 @@ void               oyjlTreeToYaml    ( oyjl_val            v,
 
            for(i = 0; i < count; ++i)
            {
-             oyjlJsonIndent_( text, "\n", *level, "-" );
+             oyjlStrIndent_( text, "\n", *level, "-" );
              *level += 2;
-             oyjlTreeToYaml( v->u.array.values[i], level, text );
+             error = oyjlTreeToYaml_( v->u.array.values[i], level, w );
              *level -= 2;
+             if(error) return error;
+             if(oyjlWriterFlush_( w, 0 )) return w->error;
            }
 
          } break;
@@ -851,21 +1683,20 @@ void               oyjlTreeToYaml    ( oyjl_val            v,
 
            for(i = 0; i < count; ++i)
            {
-             oyjlJsonIndent_( text, "\n", *level, NULL );
+             oyjlStrIndent_( text, "\n", *level, NULL );
              if(!v->u.object.keys || !v->u.object.keys[i])
              {
                oyjlMessage_p( oyjlMSG_ERROR, 0, OYJL_DBG_FORMAT "missing key", OYJL_DBG_ARGS );
-               if(text && *text)
-               {
-                 free(*text);
-                 *text = NULL;
-               }
-               return;
+               oyjlStr_Clear( text );
+               return 1;
              }
-             oyjlStringAdd( text, 0,0, "%s:", oyjlTermColor(oyjlITALIC,v->u.object.keys[i]) );
+             oyjlTreeColor_( text, oyjlITALIC, v->u.object.keys[i], flags );
+             oyjlStr_AppendN( text, ":", 1 );
              *level += 2;
-             oyjlTreeToYaml( v->u.object.values[i], level, text );
+             error = oyjlTreeToYaml_( v->u.object.values[i], level, w );
              *level -= 2;
+             if(error) return error;
+             if(oyjlWriterFlush_( w, 0 )) return w->error;
            }
          }
          break;
@@ -873,13 +1704,37 @@ void               oyjlTreeToYaml    ( oyjl_val            v,
          oyjlMessage_p( oyjlMSG_ERROR, 0, OYJL_DBG_FORMAT "unknown type: %d", OYJL_DBG_ARGS, v->type );
          break;
   }
-  return;
+  return 0;
 #undef YAML_INDENT
 }
 
-static void oyjlTreeToXml2_(oyjl_val v, const char * parent_key, int * level, oyjl_str text)
+/** @brief convert a C tree into a YAML string
+ *
+ *  @see oyjlTreeParseYaml() oyjlTreeToText() oyjlTreeWriteYaml()
+ *
+ *  @param         v                   node
+ *  @param         level               desired level depth
+ *  @param         text                the resulting string
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2019/01/01
+ *  @since   2019/01/01 (Oyranos: 0.9.7)
+ */
+void               oyjlTreeToYaml    ( oyjl_val            v,
+                                       int               * level,
+                                       char             ** text)
+{
+  oyjlWriter_s w = { NULL, 0, NULL, NULL, 0 };
+  w.text = *text ? oyjlStr_NewFrom( text, 0, 0,0 ) : oyjlStr_New( 10, 0,0 );
+  if(oyjlTreeToYaml_( v, level, &w ) == 0 && oyjlStr_Len_( w.text ))
+    *text = oyjlStr_Pull( w.text );
+  oyjlStr_Release( &w.text );
+}
+
+static void oyjlTreeToXml2_(oyjl_val v, const char * parent_key, int * level, oyjlWriter_s * w)
 {
-  const char * t;
+  oyjl_str text = w->text;
+  int flags = w->flags;
   if(!v) return;
 
   switch(v->type)
@@ -887,44 +1742,44 @@ static void oyjlTreeToXml2_(oyjl_val v, const char * parent_key, int * level, oy
     case oyjl_t_null:
          break;
     case oyjl_t_number:
-         t = oyjlTermColor(oyjlBLUE, v->u.number.r);
-         oyjlStr_AppendN (text, t, strlen(t));
+         oyjlTreeColor_( text, oyjlBLUE, v->u.number.r, flags );
          break;
     case oyjl_t_true:
-         t = oyjlTermColor(oyjlGREEN,"true");
-         oyjlStr_AppendN (text, t, strlen(t)); break;
+         oyjlTreeColor_( text, oyjlGREEN, "true", flags ); break;
     case oyjl_t_false:
-         t = oyjlTermColor(oyjlRED,"false");
-         oyjlStr_AppendN (text, t, strlen(t)); break;
+         oyjlTreeColor_( text, oyjlRED, "false", flags ); break;
     case oyjl_t_string:
          {
-          const char * t = oyjlTermColor(oyjlBOLD,v->u.string);
-          oyjlStr_AppendN (text, t, strlen(t));
+          oyjlTreeColor_( text, oyjlBOLD, v->u.string, flags );
          }
          break;
     case oyjl_t_array:
          {
-          int i,j,
+          int i,
               count = v->u.array.len;
 
           for(i = 0; i < count; ++i)
           {
             if( v->u.array.values[i] && v->u.array.values[i]->type == oyjl_t_object )
-              oyjlTreeToXml2_( v->u.array.values[i], parent_key, level, text );
+            {
+              oyjlTreeToXml2_( v->u.array.values[i], parent_key, level, w );
+              if(oyjlWriterFlush_( w, 0 )) return;
+            }
             else
             {
               /* print only values and the closing */
               for(i = 0; i < count; ++i)
               {
-                oyjlStr_AppendN( text, "\n", 1 );
-                for(j = 0; j < *level; ++j) oyjlStr_AppendN( text, " ", 1 );
-                t = oyjlTermColor(oyjlITALIC,parent_key);
-                oyjlStr_Add( text, "<%s>", t );
+                oyjlStrIndent_( text, "\n", *level, NULL );
+                oyjlStr_AppendN( text, "<", 1 );
+                oyjlTreeColor_( text, oyjlITALIC, parent_key, flags );
+                oyjlStr_AppendN( text, ">", 1 );
 
-                oyjlTreeToXml2_( v->u.array.values[i], parent_key, level, text );
+                oyjlTreeToXml2_( v->u.array.values[i], parent_key, level, w );
 
-                t = oyjlTermColor(oyjlITALIC,parent_key);
-                oyjlStr_Add( text, "</%s>", t );
+                oyjlStr_AppendN( text, "</", 2 );
+                oyjlTreeColor_( text, oyjlITALIC, parent_key, flags );
+                oyjlStr_AppendN( text, ">", 1 );
               }
             }
           }
@@ -932,7 +1787,7 @@ static void oyjlTreeToXml2_(oyjl_val v, const char * parent_key, int * level, oy
          break;
     case oyjl_t_object:
          {
-          int i,j,
+          int i,
               count = v->u.object.len;
           int is_inner_string;
 #define XML_TEXT "@text"
@@ -956,10 +1811,9 @@ static void oyjlTreeToXml2_(oyjl_val v, const char * parent_key, int * level, oy
           /* print key name of parent object */
           if(parent_key)
           {
-            oyjlStr_AppendN( text, "\n", 1 );
-            for(j = 0; j < *level; ++j) oyjlStr_AppendN( text, " ", 1 );
-            t = oyjlTermColor(oyjlITALIC,parent_key);
-            oyjlStr_Add( text, "<%s", t );
+            oyjlStrIndent_( text, "\n", *level, NULL );
+            oyjlStr_AppendN( text, "<", 1 );
+            oyjlTreeColor_( text, oyjlITALIC, parent_key, flags );
 
             /* insert attributes to key */
             for(i = 0; i < count; ++i)
@@ -1032,19 +1886,22 @@ static void oyjlTreeToXml2_(oyjl_val v, const char * parent_key, int * level, oy
                 !is_object &&
                 !is_inner_string )
             {
-              oyjlStr_AppendN( text, "\n", 1 );
-              for(j = 0; j < *level; ++j) oyjlStr_AppendN( text, " ", 1 );
+              oyjlStrIndent_( text, "\n", *level, NULL );
             }
 
             if( !is_array &&
                 !is_object &&
                 !is_inner_string )
-              oyjlStr_Add( text, "<%s>", oyjlTermColor(oyjlITALIC,key) );
+            {
+              oyjlStr_AppendN( text, "<", 1 );
+              oyjlTreeColor_( text, oyjlITALIC, key, flags );
+              oyjlStr_AppendN( text, ">", 1 );
+            }
 
             if( strcmp(key, XML_CDATA) == 0 )
               oyjlStr_AppendN( text, "<![CDATA[", 9 );
 
-            oyjlTreeToXml2_( v->u.object.values[i], key, level, text );
+            oyjlTreeToXml2_( v->u.object.values[i], key, level, w );
 
             if( strcmp(key, XML_CDATA) == 0 )
               oyjlStr_AppendN( text, "]]>", 3 );
@@ -1053,13 +1910,15 @@ static void oyjlTreeToXml2_(oyjl_val v, const char * parent_key, int * level, oy
                 !is_object &&
                 !is_inner_string )
             {
-              t = oyjlTermColor(oyjlITALIC,key);
-              oyjlStr_Add( text, "</%s>", t );
+              oyjlStr_AppendN( text, "</", 2 );
+              oyjlTreeColor_( text, oyjlITALIC, key, flags );
+              oyjlStr_AppendN( text, ">", 1 );
               last_is_content = 0;
             }
             else
             if( is_attribute )
               last_is_content = 0;
+            if(oyjlWriterFlush_( w, 0 )) return;
           }
 
           *level -= 2;
@@ -1068,11 +1927,11 @@ static void oyjlTreeToXml2_(oyjl_val v, const char * parent_key, int * level, oy
           {
             if( !last_is_content )
             {
-              oyjlStr_AppendN( text, "\n", 1 );
-              for(j = 0; j < *level; ++j) oyjlStr_AppendN( text, " ", 1 );
+              oyjlStrIndent_( text, "\n", *level, NULL );
             }
-            t = oyjlTermColor(oyjlITALIC,parent_key);
-            oyjlStr_Add( text, "</%s>", t );
+            oyjlStr_AppendN( text, "</", 2 );
+            oyjlTreeColor_( text, oyjlITALIC, parent_key, flags );
+            oyjlStr_AppendN( text, ">", 1 );
           }
          }
          break;
@@ -1082,30 +1941,13 @@ static void oyjlTreeToXml2_(oyjl_val v, const char * parent_key, int * level, oy
   }
 }
 
-/** @brief convert a C tree into a XML string
- *
- *  The function uses some assumptions for mapping features of JSON to XML.
- *
- *  The JSON tree shall consist of one root object. Object keys starting with
- *  '@' are mapped to a attribute of the parent key. A object key of
- *  "@text" is mapped to the inner XML content of the parent tree object.
- *
- *  @see oyjlTreeParseXml()
- *
- *  @param         v                   node
- *  @param         level               desired level depth
- *  @param         text                the resulting string
- *
- *  @version Oyranos: 0.9.7
- *  @date    2019/06/14
- *  @since   2019/01/01 (Oyranos: 0.9.7)
- */
-void               oyjlTreeToXml     ( oyjl_val            v,
+static int  oyjlTreeToXml_           ( oyjl_val            v,
                                        int               * level,
-                                       char             ** text)
+                                       oyjlWriter_s      * w )
 {
-  oyjlStringAdd( text, 0,0, "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>" );
-  if(v && text && *text)
+  const char * header = "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>";
+  oyjlStr_AppendN( w->text, header, strlen(header) );
+  if(v)
   switch(v->type)
   {
     case oyjl_t_null:
@@ -1128,21 +1970,46 @@ void               oyjlTreeToXml     ( oyjl_val            v,
           if(!v->u.object.keys || !v->u.object.keys[0])
           {
             oyjlMessage_p( oyjlMSG_ERROR, 0, OYJL_DBG_FORMAT "missing key", OYJL_DBG_ARGS );
-            free(*text);
-            *text = NULL;
-            return;
+            oyjlStr_Clear( w->text );
+            return 1;
           }
-          oyjl_str str = oyjlStr_NewFrom(text, 0, 0,0);
-          oyjlTreeToXml2_( v->u.object.values[0], v->u.object.keys[0], level, str );
-          *text = oyjlStr_Pull( str );
-          oyjlStr_Release( &str );
+          oyjlTreeToXml2_( v->u.object.values[0], v->u.object.keys[0], level, w );
          }
          break;
     default:
           oyjlMessage_p( oyjlMSG_ERROR, 0, OYJL_DBG_FORMAT "unknown type: %d", OYJL_DBG_ARGS, v->type );
          break;
   }
-  return;
+  return 0;
+}
+
+/** @brief convert a C tree into a XML string
+ *
+ *  The function uses some assumptions for mapping features of JSON to XML.
+ *
+ *  The JSON tree shall consist of one root object. Object keys starting with
+ *  '@' are mapped to a attribute of the parent key. A object key of
+ *  "@text" is mapped to the inner XML content of the parent tree object.
+ *
+ *  @see oyjlTreeParseXml() oyjlTreeToText() oyjlTreeWriteXml()
+ *
+ *  @param         v                   node
+ *  @param         level               desired level depth
+ *  @param         text                the resulting string
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2019/06/14
+ *  @since   2019/01/01 (Oyranos: 0.9.7)
+ */
+void               oyjlTreeToXml     ( oyjl_val            v,
+                                       int               * level,
+                                       char             ** text)
+{
+  oyjlWriter_s w = { NULL, 0, NULL, NULL, 0 };
+  w.text = *text ? oyjlStr_NewFrom( text, 0, 0,0 ) : oyjlStr_New( 10, 0,0 );
+  if(oyjlTreeToXml_( v, level, &w ) == 0)
+    *text = oyjlStr_Pull( w.text );
+  oyjlStr_Release( &w.text );
 }
 
 /** @brief return the number of members if any at the node level
@@ -1152,11 +2019,19 @@ void               oyjlTreeToXml     ( oyjl_val            v,
 int            oyjlValueCount        ( oyjl_val            v )
 {
   int count = 0;
+  const oyjlNode_s * node = oyjlNodeGet_( v );
 
   if(!v)
     return count;
 
-  if(v->type == oyjl_t_object)
+  if(node)
+  {
+    if(node->type == oyjl_t_object || node->type == oyjl_t_array)
+      count = node->len;
+  }
+  else if((long)v->type == oyjlOBJECT_JSON)
+    count = oyjlNodesCount_( (const oyjlNodes_s*)v );
+  else if(v->type == oyjl_t_object)
     count = v->u.object.len;
   else if(v->type == oyjl_t_array)
     count = v->u.array.len;
@@ -1168,9 +2043,23 @@ int            oyjlValueCount        ( oyjl_val            v )
 oyjl_val       oyjlValuePosGet       ( oyjl_val            v,
                                        int                 pos )
 {
+  const oyjlNode_s * node = oyjlNodeGet_( v );
+
   if(!v)
     return NULL;
 
+  if(node)
+  {
+    const uint64_t * offsets = (const uint64_t *)oyjlNodeData_m( node );
+    if(pos < 0 || (uint32_t)pos >= node->len)
+      return NULL;
+    if(node->type == oyjl_t_object)
+      return (oyjl_val)((const char*)node + offsets[2*pos + 1]);
+    else if(node->type == oyjl_t_array)
+      return (oyjl_val)((const char*)node + offsets[pos]);
+    return NULL;
+  }
+
   if(v->type == oyjl_t_object)
     return v->u.object.values[pos];
   else if(v->type == oyjl_t_array)
@@ -1179,6 +2068,36 @@ oyjl_val       oyjlValuePosGet       ( oyjl_val            v,
   return NULL;
 }
 
+/** @brief obtain the key at the nth position from a object node
+ *
+ *  Works on parsed trees and on oyjlTreeSerialise( ::OYJL_NESTED ) blocks.
+ *
+ *  @version Oyjl: 1.0.0
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyjl: 1.0.0)
+ */
+const char *   oyjlValuePosGetKey    ( oyjl_val            v,
+                                       int                 pos )
+{
+  const oyjlNode_s * node = oyjlNodeGet_( v );
+
+  if(!v || pos < 0)
+    return NULL;
+
+  if(node)
+  {
+    const uint64_t * offsets = (const uint64_t *)oyjlNodeData_m( node );
+    if(node->type == oyjl_t_object && (uint32_t)pos < node->len)
+      return (const char*)node + offsets[2*pos];
+    return NULL;
+  }
+
+  if(v->type == oyjl_t_object && (size_t)pos < v->u.object.len)
+    return v->u.object.keys[pos];
+
+  return NULL;
+}
+
 /** @internal 
  *  @brief tell about xpath segment
  *
@@ -1324,6 +2243,10 @@ static oyjl_val  oyjlTreeGetValue_   ( oyjl_val            v,
   int n = 0, i, found = 0;
   char ** list = oyjlStringSplit(xpath, '/', &n, malloc);
 
+  /* serialised nodes are read only */
+  if(oyjlNodeGet_( v ))
+    flags &= ~OYJL_CREATE_NEW;
+
   if(!oyjl_debug_node_path_)
   {
     const char * t = getenv("OYJL_DEBUG_NODE");
@@ -1406,15 +2329,27 @@ static oyjl_val  oyjlTreeGetValue_   ( oyjl_val            v,
       found = 1;
     } else
     {
+      /* a term without escapes and special chars equals only the same plain key */
+      int plain = strpbrk( term, "\\%[].^$*+?(){|/" ) == NULL;
       /* search for name in object */
       for(j = 0; j < count; ++j)
       {
-        const char * key = parent->u.object.keys[j];
+        const char * key = oyjlValuePosGetKey( parent, j );
         char * regex = NULL;
+        if(plain && key)
+        {
+          if(strcmp( key, term ) == 0 || term[0] == '\000')
+          {
+            found = 1;
+            level = oyjlValuePosGet( parent, j );
+            break;
+          }
+          continue;
+        }
         /* search for regex escaped key */
-        if(strpbrk(key, "[].^$*+?(){|/"))
+        if(key && strpbrk(key, "[].^$*+?(){|/"))
           regex = oyjlJsonEscape(key, OYJL_KEY | OYJL_REGEXP);
-        if((parent->type == oyjl_t_object && strcmp( regex?regex:key, term ) == 0) ||
+        if((key && strcmp( regex?regex:key, term ) == 0) ||
             /* a empty term matches to everything */
            term[0] == '\000')
         {
@@ -1504,7 +2439,7 @@ clean:
     return NULL;
   }
 
-  if(oyjl_debug_node_path_[0])
+  if(oyjl_debug_node_path_[0] && !oyjlNodeGet_( result ))
   {
     if(oyjlPathMatch(xpath, oyjl_debug_node_path_, 0))
     {
@@ -1585,6 +2520,10 @@ char *     oyjlTreeGetPath           ( oyjl_val            v,
 }
 
 /** @brief obtain a node by a path expression
+ *
+ *  A oyjlTreeSerialise() oiJS block is searched without deserialising.
+ *  Only full leaf paths are found. The result is a borrowed read only
+ *  view into the block and is valid as long as the block.
  *
  *  @see oyjlTreeGetValueF() */
 oyjl_val   oyjlTreeGetValue          ( oyjl_val            v,
@@ -1593,6 +2532,8 @@ oyjl_val   oyjlTreeGetValue          ( oyjl_val            v,
 {
   if(!v || !xpath)
     return NULL;
+  else if((long)v->type == oyjlOBJECT_JSON)
+    return oyjlNodesGetValue_( (const oyjlNodes_s*)v, xpath );
   else
     return oyjlTreeGetValue_(v,flags,xpath);
 }
@@ -2031,7 +2972,7 @@ void oyjlTreeClearValue              ( oyjl_val            root,
              if( p->u.object.values[i] == o )
              {
                if(p->u.object.keys[i])
-                 free(p->u.object.keys[i]);
+                 oyjlKeyFree_(p->u.object.keys[i]);
                p->u.object.keys[i] = NULL;
 
 	       oyjlTreeFree( o );
@@ -2082,7 +3023,9 @@ void oyjlTreeFree (oyjl_val v)
 {
     if (v == NULL) return;
 
-    if((long)v->type != oyjlOBJECT_JSON)
+    if((long)v->type == oyjlOBJECT_JSON)
+      oyjlNodesViewsRelease_( v );
+    else if((long)v->type != oyjlOBJECT_JSON_TREE)
       oyjlValueClear (v);
 
     free(v);
@@ -2107,43 +3050,623 @@ const char*oyjlTreeGetStringF2_      ( oyjl_val            v,
                                        int                 flags,
                                        const char        * format,
                                                            ... );
+const char * oyjlXPath_Print_        ( oyjlXPath_s       * node );
+char **          oyjlCatalogGetLangs_( char             ** paths,
+                                       int                 count,
+                                       int               * langs_n,
+                                       int              ** lang_positions_start );
 
-char *         oyjlTranslate2_       ( const char        * loc,
-                                       oyjl_val            catalog,
-                                       int                 start,
-                                       int                 end,
-                                       const char        * domain OYJL_UNUSED,
-                                       const char        * text,
-                                       int                 flags )
+/* msgid table behind the oiJS block of a oiJF catalog file
+ *
+ * Written by oyjlTreeSerialiseToFile() and probed in place after
+ * oyjlTreeMapFile(). Each slot lists the catalog nodes of one unescaped
+ * msgid in catalog order. The langs are the oyjlCatalogGetLangs_() result.
+ * All offsets are distances from the oyjlTrFile_s start. */
+typedef struct oyjlTrFile_s
 {
-  const char * translated = NULL;
-  oyjl_val v;
-  char * key = NULL, * tmp = NULL, * loc_ = NULL;
+  char type [8];                       /* place 'oiJI' here for oyjl Json Index */
+  uint32_t size;                       /* size of the whole table */
+  uint32_t n;                          /* slots; power of two */
+  uint32_t count;                      /* used slots */
+  uint32_t nodes_n;                    /* entries in the node list */
+  uint32_t langs_n;                    /* entries in the lang list */
+  uint32_t reserved;
+  /* oyjlTrFileSlot_s slots[n];
+   * uint32_t nodes[nodes_n];          position in oyjlNodes_s::offsets
+   * oyjlTrFileLang_s langs[langs_n];
+   * msgid and lang strings */
+} oyjlTrFile_s;
+
+typedef struct oyjlTrFileSlot_s
+{
+  uint32_t hash;
+  uint32_t msgid;                      /* unescaped msgid string */
+  uint32_t first;                      /* first entry in the node list */
+  uint32_t n;                          /* entries in the node list; 0 for a free slot */
+} oyjlTrFileSlot_s;
 
-  if(flags & OYJL_GETTEXT)
-  {
-#ifdef OYJL_USE_GETTEXT
-    const char * t = NULL;;
-    if(!domain)
-    {
-      if(flags & OYJL_OBSERVE)
-        oyjlMessage_p( oyjlMSG_INFO, 0, OYJL_DBG_FORMAT "domain is missed", OYJL_DBG_ARGS );
-    } else if(text && text[0])
-      t = dgettext( domain, text );
-    if(t)
-      translated = t;
-#endif
-    return translated ? (char*)translated : (char*)text;
-  }
+typedef struct oyjlTrFileLang_s
+{
+  uint32_t name;                       /* unescaped lang string */
+  uint32_t start;                      /* first node of that lang */
+} oyjlTrFileLang_s;
+#define oyjlTrFileSlots_m( file ) ((const oyjlTrFileSlot_s*)((const char*)(file) + sizeof(oyjlTrFile_s)))
+#define oyjlTrFileNodes_m( file ) ((const uint32_t*)(oyjlTrFileSlots_m( file ) + (file)->n))
+#define oyjlTrFileLangs_m( file ) ((const oyjlTrFileLang_s*)(oyjlTrFileNodes_m( file ) + (file)->nodes_n))
+static const oyjlTrFile_s * oyjlTreeMappedTrFile_( oyjl_val v );
+
+/* msgid -> translation hash for one resolved locale chain
+ *
+ * Filled by oyjlTrIndexNew_() in oyjlTr_New() and oyjlTr_SetLocale().
+ * oyjlTranslate() does then a single probe without allocation. */
+typedef struct oyjlTrEntry_s
+{
+  uint32_t hash;
+  const char * msgid;                  /* unescaped key */
+  const char * translation;            /* points into the catalog */
+} oyjlTrEntry_s;
+
+struct oyjlTrIndex_s
+{
+  oyjlTrEntry_s * entries;
+  size_t n;                            /* power of two */
+  size_t count;
+  char ** owned;                       /* unescaped keys from oiJS catalogs */
+  int owned_n;
+  const oyjlTrFile_s * file;           /* table of a mapped catalog; used instead of entries */
+  const oyjlNodes_s * nodes;           /* the mapped catalog */
+  char * chain[3];                     /* escaped loc, language_country and language */
+};
+
+/* locale dependent part of oyjlTr_s
+ *
+ * oyjlTr_SetLocale() publishes a new state with a single pointer store.
+ * oyjlTranslate() loads that pointer once and sees a consistent lang,
+ * range and index. A replaced state stays valid until oyjlTr_Release(),
+ * as other threads might still read from it. The states are cached per
+ * loc, so switching back to a loc reuses its resolved lang and index. */
+struct oyjlTrState_s
+{
+  char * loc;
+  char * lang;                         /* optimised loc or NULL */
+  int start;                           /* lang start in catalog paths */
+  int end;                             /* lang end in catalog paths */
+  struct oyjlTrIndex_s * index;
+  struct oyjlTrState_s * next;         /* older state of the same context */
+};
+
+/* one catalog entry as seen while collecting */
+typedef struct oyjlTrItem_s
+{
+  const char * loc;
+  const char * msgid;
+  const char * translation;
+  uint32_t node;                       /* position in oyjlNodes_s::offsets */
+} oyjlTrItem_s;
+
+typedef struct oyjlTrItems_s
+{
+  oyjlTrItem_s * items;
+  size_t n;
+  size_t reserved;
+  char ** owned;                       /* unescaped strings */
+  int owned_n;
+} oyjlTrItems_s;
+
+static int   oyjlTrItemsAdd_         ( oyjlTrItems_s     * list,
+                                       const char        * loc,
+                                       const char        * msgid,
+                                       const char        * translation,
+                                       uint32_t            node )
+{
+  if(list->n == list->reserved)
+  {
+    size_t reserved = list->reserved ? list->reserved * 2 : 256;
+    oyjlTrItem_s * items = (oyjlTrItem_s*) realloc( list->items, reserved * sizeof(oyjlTrItem_s) );
+    if(!items) return 1;
+    list->items = items;
+    list->reserved = reserved;
+  }
+  list->items[list->n].loc = loc;
+  list->items[list->n].msgid = msgid;
+  list->items[list->n].translation = translation;
+  list->items[list->n].node = node;
+  ++list->n;
+  return 0;
+}
+
+/* keep text, if it differs from the escaped source, else use source */
+static const char * oyjlTrItemsUnescape_( oyjlTrItems_s  * list,
+                                       const char        * escaped,
+                                       int                 len )
+{
+  char * raw = oyjlStringAppendN( NULL, escaped, len, malloc ),
+       * t;
+  if(!raw) return NULL;
+  t = oyjlJsonEscape( raw, OYJL_REVERSE | OYJL_REGEXP | OYJL_KEY );
+  free( raw );
+  if(!t) return NULL;
+  oyjlStringListAddString( &list->owned, &list->owned_n, t, malloc,free );
+  free( t );
+  return list->owned[list->owned_n - 1];
+}
+
+#define OYJL_TR_BASE "org/freedesktop/oyjl/translations/"
+/* flat list of all translations in the catalog */
+static void  oyjlTrItemsCollect_     ( oyjlTrItems_s     * list,
+                                       oyjl_val            catalog )
+{
+  if((long)catalog->type == oyjlOBJECT_JSON)
+  {
+    oyjlNodes_s * nodes = (oyjlNodes_s *)catalog;
+    size_t base_len = strlen(OYJL_TR_BASE), i;
+    const char * loc = NULL, * last = NULL;
+    int last_len = 0;
+
+    for(i = 0; i < nodes->count; ++i)
+    {
+      oyjlXPath_s * node = (oyjlXPath_s *)&((char*)nodes)[nodes->offsets[i]];
+      const char * xpath = ((const char*)node) + sizeof(uint32_t),
+                 * l, * key, * translation;
+      if(memcmp( xpath, OYJL_TR_BASE, base_len ) != 0)
+        continue;
+      l = xpath + base_len;
+      key = strchr( l, '/' );
+      translation = oyjlXPath_Print_( node );
+      if(!key || !translation)
+        continue;
+      /* paths are sorted, so unescape each locale only once */
+      if(!last || last_len != key - l || memcmp( last, l, last_len ) != 0)
+      {
+        last = l;
+        last_len = key - l;
+        loc = oyjlTrItemsUnescape_( list, l, last_len );
+      }
+      ++key;
+      if(!strpbrk( key, "\\%" ))
+        oyjlTrItemsAdd_( list, loc, key, translation, i );
+      else
+        oyjlTrItemsAdd_( list, loc, oyjlTrItemsUnescape_( list, key, strlen(key) ), translation, i );
+    }
+  }
+  else
+  {
+    oyjl_val locs = oyjlTreeGetValue( catalog, 0, "org/freedesktop/oyjl/translations" );
+    size_t i, j;
+    if(!locs || !OYJL_IS_OBJECT(locs))
+      return;
+    for(i = 0; i < locs->u.object.len; ++i)
+    {
+      oyjl_val tr = locs->u.object.values[i];
+      if(!tr || !OYJL_IS_OBJECT(tr))
+        continue;
+      for(j = 0; j < tr->u.object.len; ++j)
+      {
+        const char * translation = OYJL_GET_STRING(tr->u.object.values[j]);
+        if(translation)
+          oyjlTrItemsAdd_( list, locs->u.object.keys[i], tr->u.object.keys[j], translation, 0 );
+      }
+    }
+  }
+}
+
+/* first entry wins; later members of the chain only fill gaps */
+static int   oyjlTrIndexAdd_         ( struct oyjlTrIndex_s * index,
+                                       const char        * msgid,
+                                       const char        * translation )
+{
+  uint32_t hash;
+  size_t h;
+
+  if(!msgid || !msgid[0])
+    return 0;
+  if((index->count + 1) * 2 > index->n)
+  {
+    size_t n = index->n ? index->n * 2 : 64, i;
+    oyjlTrEntry_s * entries = (oyjlTrEntry_s*) calloc( n, sizeof(oyjlTrEntry_s) );
+    if(!entries) return 1;
+    for(i = 0; i < index->n; ++i)
+    {
+      oyjlTrEntry_s * e = &index->entries[i];
+      if(!e->msgid) continue;
+      h = e->hash & (n - 1);
+      while(entries[h].msgid) h = (h + 1) & (n - 1);
+      entries[h] = *e;
+    }
+    free( index->entries );
+    index->entries = entries;
+    index->n = n;
+  }
+
+  hash = oyjlNodesChecksum_( msgid, strlen(msgid) );
+  h = hash & (index->n - 1);
+  while(index->entries[h].msgid)
+  {
+    if(index->entries[h].hash == hash && strcmp( index->entries[h].msgid, msgid ) == 0)
+      return 0;
+    h = (h + 1) & (index->n - 1);
+  }
+  index->entries[h].hash = hash;
+  index->entries[h].msgid = msgid;
+  index->entries[h].translation = translation;
+  ++index->count;
+  return 0;
+}
+
+void         oyjlTrIndexRelease_     ( struct oyjlTrIndex_s ** index )
+{
+  if(!index || !*index) return;
+  if((*index)->entries) free( (*index)->entries );
+  if((*index)->owned_n) oyjlStringListRelease( &(*index)->owned, (*index)->owned_n, free );
+  if((*index)->chain[0]) free( (*index)->chain[0] );
+  if((*index)->chain[1]) free( (*index)->chain[1] );
+  if((*index)->chain[2]) free( (*index)->chain[2] );
+  free( *index );
+  *index = NULL;
+}
+
+static int   oyjlTrItemCmp_          ( const void        * a_,
+                                       const void        * b_ )
+{
+  const oyjlTrItem_s * a = (const oyjlTrItem_s*)a_,
+                     * b = (const oyjlTrItem_s*)b_;
+  int r = strcmp( a->msgid, b->msgid );
+  if(r == 0)
+    r = a->node < b->node ? -1 : a->node > b->node;
+  return r;
+}
+
+/* build the oyjlTrFile_s table of a oiJS catalog; NULL without translations */
+static char *oyjlTrFileNew_          ( oyjl_val            catalog,
+                                       uint32_t          * size )
+{
+  oyjlTrItems_s list;
+  oyjlTrFile_s * file = NULL;
+  oyjlTrFileSlot_s * slots;
+  oyjlTrFileLang_s * langs_list;
+  uint32_t * nodes_list;
+  char ** paths = NULL, ** langs = NULL, * text;
+  int * langs_start = NULL;
+  int count = 0, langs_n = 0, i;
+  size_t n = 8, used = 0, strings = 0, size_, j, k;
+
+  if(!catalog || (long)catalog->type != oyjlOBJECT_JSON)
+    return NULL;
+
+  memset( &list, 0, sizeof(list) );
+  oyjlTrItemsCollect_( &list, catalog );
+  /* keep what oyjlTrIndexAdd_() would take */
+  for(j = 0, k = 0; j < list.n; ++j)
+    if(list.items[j].loc && list.items[j].msgid && list.items[j].msgid[0] && list.items[j].translation)
+      list.items[k++] = list.items[j];
+  list.n = k;
+  if(!list.n)
+    goto oyjlTrFileNew_clean;
+
+  /* group each msgid, with its nodes in catalog order */
+  qsort( list.items, list.n, sizeof(oyjlTrItem_s), oyjlTrItemCmp_ );
+  for(j = 0; j < list.n; ++j)
+    if(j == 0 || strcmp( list.items[j].msgid, list.items[j-1].msgid ) != 0)
+    {
+      ++used;
+      strings += strlen( list.items[j].msgid ) + 1;
+    }
+  while(n < used * 2) n *= 2;
+
+  paths = oyjlTreeToPaths( catalog, 10000000, NULL, OYJL_KEY | OYJL_NO_ALLOC, &count );
+  langs = oyjlCatalogGetLangs_( paths, count, &langs_n, &langs_start );
+  if(paths) free( paths );
+  for(i = 0; i < langs_n; ++i)
+    strings += strlen( langs[i] ) + 1;
+
+  size_ = sizeof(oyjlTrFile_s) + n * sizeof(oyjlTrFileSlot_s) + list.n * sizeof(uint32_t) +
+          langs_n * sizeof(oyjlTrFileLang_s) + strings;
+  if(size_ > UINT32_MAX)
+    goto oyjlTrFileNew_clean;
+  file = (oyjlTrFile_s*) calloc( size_, sizeof(char) );
+  if(!file)
+    goto oyjlTrFileNew_clean;
+  memcpy( file->type, "oiJI", 4 );
+  file->size = size_;
+  file->n = n;
+  file->count = used;
+  file->nodes_n = list.n;
+  file->langs_n = langs_n;
+  slots = (oyjlTrFileSlot_s*)oyjlTrFileSlots_m( file );
+  nodes_list = (uint32_t*)(slots + n);
+  langs_list = (oyjlTrFileLang_s*)(nodes_list + list.n);
+  text = (char*)(langs_list + langs_n);
+
+  for(j = 0; j < list.n; j = k)
+  {
+    const char * msgid = list.items[j].msgid;
+    size_t len = strlen( msgid ), h;
+    uint32_t hash = oyjlNodesChecksum_( msgid, len );
+    for(k = j; k < list.n && strcmp( list.items[k].msgid, msgid ) == 0; ++k)
+      nodes_list[k] = list.items[k].node;
+    h = hash & (n - 1);
+    while(slots[h].n) h = (h + 1) & (n - 1);
+    slots[h].hash = hash;
+    slots[h].msgid = text - (char*)file;
+    slots[h].first = j;
+    slots[h].n = k - j;
+    memcpy( text, msgid, len + 1 );
+    text += len + 1;
+  }
+  for(i = 0; i < langs_n; ++i)
+  {
+    size_t len = strlen( langs[i] );
+    langs_list[i].name = text - (char*)file;
+    langs_list[i].start = langs_start[i];
+    memcpy( text, langs[i], len + 1 );
+    text += len + 1;
+  }
+  *size = size_;
+
+oyjlTrFileNew_clean:
+  if(langs_n) oyjlStringListRelease( &langs, langs_n, free );
+  if(langs_start) free( langs_start );
+  if(list.owned_n) oyjlStringListRelease( &list.owned, list.owned_n, free );
+  if(list.items) free( list.items );
+
+  return (char*)file;
+}
+
+/* header and bounds of a oiJF table; the lookups check the entries */
+static int   oyjlTrFileCheck_        ( const char        * block,
+                                       size_t              size )
+{
+  const oyjlTrFile_s * file = (const oyjlTrFile_s *)block;
+  if(size < sizeof(oyjlTrFile_s) || memcmp( file->type, "oiJI", 4 ) != 0 ||
+     file->size != size || !file->n || file->n & (file->n - 1) || file->count >= file->n)
+    return 1;
+  if(sizeof(oyjlTrFile_s) + (uint64_t)file->n * sizeof(oyjlTrFileSlot_s) +
+     (uint64_t)file->nodes_n * sizeof(uint32_t) + (uint64_t)file->langs_n * sizeof(oyjlTrFileLang_s) > size)
+    return 1;
+  return block[size - 1] != '\000';
+}
+
+/* probe the table of a mapped catalog in place,
+ * with the same precedence as the oyjlTrIndexNew_() entries */
+static const char * oyjlTrFileGet_   ( struct oyjlTrIndex_s * index,
+                                       const char        * text )
+{
+  const oyjlTrFile_s * file = index->file;
+  const oyjlTrFileSlot_s * slots = oyjlTrFileSlots_m( file ),
+                         * slot = NULL;
+  const uint32_t * nodes_list = oyjlTrFileNodes_m( file );
+  const oyjlNodes_s * nodes = index->nodes;
+  size_t base_len = strlen(OYJL_TR_BASE), h, probes;
+  uint32_t hash = oyjlNodesChecksum_( text, strlen(text) ), i;
+  int c;
+
+  h = hash & (file->n - 1);
+  for(probes = 0; probes < file->n && slots[h].n; ++probes)
+  {
+    if(slots[h].hash == hash && slots[h].msgid < file->size &&
+       strcmp( (const char*)file + slots[h].msgid, text ) == 0)
+    {
+      slot = &slots[h];
+      break;
+    }
+    h = (h + 1) & (file->n - 1);
+  }
+  if(!slot || slot->first > file->nodes_n || slot->n > file->nodes_n - slot->first)
+    return NULL;
+
+  /* loc, language_country, language and then any language variant */
+  for(c = 0; c < 4; ++c)
+  {
+    const char * l = index->chain[c < 3 ? c : 2];
+    size_t len = l ? strlen(l) : 0;
+    if(!len)
+      continue;
+    for(i = 0; i < slot->n; ++i)
+    {
+      uint32_t pos = nodes_list[slot->first + i];
+      oyjlXPath_s * node;
+      const char * loc;
+      if(pos >= nodes->count)
+        continue;
+      node = (oyjlXPath_s *)&((char*)nodes)[nodes->offsets[pos]];
+      loc = ((const char*)node) + sizeof(uint32_t) + base_len;
+      if(strncmp( loc, l, len ) == 0 && (c == 3 || loc[len] == '/'))
+        return oyjlXPath_Print_( node );
+    }
+  }
+  return NULL;
+}
+
+/* the oyjlCatalogGetLangs_() result stored in a oiJF table */
+static char ** oyjlTrFileGetLangs_   ( const oyjlTrFile_s * file,
+                                       int               * langs_n,
+                                       int              ** lang_positions_start )
+{
+  const oyjlTrFileLang_s * langs = oyjlTrFileLangs_m( file );
+  char ** locs = NULL;
+  int * locs_start = NULL;
+  int locs_n = 0;
+  uint32_t i;
+
+  if(file->langs_n)
+    locs_start = (int*) calloc( file->langs_n, sizeof(int) );
+  for(i = 0; locs_start && i < file->langs_n; ++i)
+    if(langs[i].name < file->size)
+    {
+      locs_start[locs_n] = langs[i].start;
+      oyjlStringListAddString( &locs, &locs_n, (const char*)file + langs[i].name, malloc,free );
+    }
+  if(!locs_n && locs_start)
+  {
+    free( locs_start );
+    locs_start = NULL;
+  }
+
+  *langs_n = locs_n;
+  *lang_positions_start = locs_start;
+  return locs;
+}
+
+/* Resolve loc to the chain loc, language_country, language and any
+ * language variant. For loc "back" map each translation to its msgid
+ * instead. */
+struct oyjlTrIndex_s * oyjlTrIndexNew_( oyjl_val           catalog,
+                                       const char        * loc )
+{
+  struct oyjlTrIndex_s * index = NULL;
+  oyjlTrItems_s list;
+  char * language, * country, * lang_country = NULL;
+  const char * chain[3];
+  const oyjlTrFile_s * file = NULL;
+  size_t i, language_len;
+  int c;
+
+  if(!catalog || !loc || !loc[0] || strcmp(loc,"C") == 0)
+    return NULL;
+
+  /* a mapped oiJF table is probed in place; only "back" needs the list */
+  if(strcmp(loc,"back") != 0)
+    file = oyjlTreeMappedTrFile_( catalog );
+
+  memset( &list, 0, sizeof(list) );
+  if(!file)
+    oyjlTrItemsCollect_( &list, catalog );
+
+  if(strcmp(loc,"back") == 0)
+  {
+    index = (struct oyjlTrIndex_s*) calloc( 1, sizeof(struct oyjlTrIndex_s) );
+    if(index)
+    {
+      /* explicit translations/back entries come first, then the
+       * first msgid in catalog order for each translation */
+      for(i = 0; i < list.n; ++i)
+        if(list.items[i].loc && strcmp( list.items[i].loc, "back" ) == 0)
+          oyjlTrIndexAdd_( index, list.items[i].msgid, list.items[i].translation );
+      for(i = 0; i < list.n; ++i)
+        if(!list.items[i].loc || strcmp( list.items[i].loc, "back" ) != 0)
+          oyjlTrIndexAdd_( index, list.items[i].translation, list.items[i].msgid );
+      index->owned = list.owned;
+      index->owned_n = list.owned_n;
+      list.owned = NULL;
+      list.owned_n = 0;
+    }
+    if(list.owned_n) oyjlStringListRelease( &list.owned, list.owned_n, free );
+    if(list.items) free( list.items );
+    return index;
+  }
+
+  language = oyjlLanguage( loc );
+  country = oyjlCountry( loc );
+  if(language && country)
+    oyjlStringAdd( &lang_country, 0,0, "%s_%s", language, country );
+  chain[0] = loc;
+  chain[1] = lang_country;
+  chain[2] = language;
+  language_len = language ? strlen(language) : 0;
+
+  index = (struct oyjlTrIndex_s*) calloc( 1, sizeof(struct oyjlTrIndex_s) );
+  if(index && file)
+  {
+    index->file = file;
+    index->nodes = (const oyjlNodes_s *)catalog;
+    /* keep the chain in catalog path escaping */
+    for(c = 0; c < 3; ++c)
+      if(chain[c])
+        index->chain[c] = oyjlJsonEscape( chain[c], OYJL_KEY | OYJL_REGEXP );
+  }
+  else if(index)
+  {
+    for(c = 0; c < 3; ++c)
+      for(i = 0; chain[c] && i < list.n; ++i)
+        if(list.items[i].loc && strcmp( list.items[i].loc, chain[c] ) == 0)
+          oyjlTrIndexAdd_( index, list.items[i].msgid, list.items[i].translation );
+    for(i = 0; language_len && i < list.n; ++i)
+      if(list.items[i].loc && strncmp( list.items[i].loc, language, language_len ) == 0)
+        oyjlTrIndexAdd_( index, list.items[i].msgid, list.items[i].translation );
+    /* the index keeps the unescaped strings alive */
+    index->owned = list.owned;
+    index->owned_n = list.owned_n;
+    list.owned = NULL;
+    list.owned_n = 0;
+  }
+
+  if(list.owned_n) oyjlStringListRelease( &list.owned, list.owned_n, free );
+  if(list.items) free( list.items );
+  if(language) free( language );
+  if(country) free( country );
+  if(lang_country) free( lang_country );
+
+  return index;
+}
+
+static const char * oyjlTrIndexGet_  ( struct oyjlTrIndex_s * index,
+                                       const char        * text )
+{
+  uint32_t hash;
+  size_t h;
+
+  if(index && index->file)
+    return oyjlTrFileGet_( index, text );
+  if(!index || !index->n)
+    return NULL;
+
+  hash = oyjlNodesChecksum_( text, strlen(text) );
+  h = hash & (index->n - 1);
+  while(index->entries[h].msgid)
+  {
+    if(index->entries[h].hash == hash && strcmp( index->entries[h].msgid, text ) == 0)
+      return index->entries[h].translation;
+    h = (h + 1) & (index->n - 1);
+  }
+  return NULL;
+}
+
+char *         oyjlTranslate2_       ( const char        * loc,
+                                       oyjl_val            catalog,
+                                       struct oyjlTrIndex_s * index,
+                                       int                 start,
+                                       int                 end,
+                                       const char        * domain OYJL_UNUSED,
+                                       const char        * text,
+                                       int                 flags )
+{
+  const char * translated = NULL;
+  oyjl_val v;
+  char * key = NULL, * tmp = NULL, * loc_ = NULL;
+
+  if(flags & OYJL_GETTEXT)
+  {
+#ifdef OYJL_USE_GETTEXT
+    const char * t = NULL;;
+    if(!domain)
+    {
+      if(flags & OYJL_OBSERVE)
+        oyjlMessage_p( oyjlMSG_INFO, 0, OYJL_DBG_FORMAT "domain is missed", OYJL_DBG_ARGS );
+    } else if(text && text[0])
+      t = dgettext( domain, text );
+    if(t)
+      translated = t;
+#endif
+    return translated ? (char*)translated : (char*)text;
+  }
 
   if(!loc || !loc[0] || strcmp(loc,"C") == 0 || !catalog || !text || (text && !text[0]))
     return (char*)text;
 
+  /* the index covers every locale searched below; so a miss is final */
+  if(index && !oyjlTrIndexGet_( index, text ))
+    return (char*)text;
+  /* the reverse index maps each translation to its msgid */
+  if(index && strcmp(loc,"back") == 0)
+    return (char*)oyjlTrIndexGet_( index, text );
+
   key = oyjlJsonEscape( text, OYJL_KEY | OYJL_REGEXP );
   if(flags & OYJL_OBSERVE)
     oyjlMessage_p( oyjlMSG_INFO, 0, OYJL_DBG_FORMAT "text: \"%s\" escape: \"%s\" key: \"%s\"", OYJL_DBG_ARGS, text, tmp, key );
   if(tmp) {free(tmp); tmp = NULL;}
 
+  /* contexts bring a reverse index; the scan below caches into the
+   * catalog and is not safe for concurrent readers */
   if(strcmp(loc,"back") == 0 && text[0])
   {
     char * path = NULL;
@@ -2197,83 +3720,25 @@ char *         oyjlTranslate2_       ( const char        * loc,
   translated = oyjlTreeGetStringF2_(catalog, start, end, flags, "org/freedesktop/oyjl/translations/%s/%s", loc_, key );
   if(end && !(flags & OYJL_NO_OPTIMISE))
     goto oyjlTranslate2_clean;
-  if(!translated)
+  /* language_country, language and language variants are all in the
+   * locale chain index; a miss is a single probe */
+  if(!translated && index)
+    translated = oyjlTrIndexGet_( index, text );
+  /* without index try language_country and language by path only;
+   * variants need the index from oyjlTr_New() or oyjlTr_SetLocale() */
+  else if(!translated)
   {
-    char * language = oyjlLanguage(loc),
-         * country = oyjlCountry(loc);
+    char * language = oyjlLanguage( loc ),
+         * country = oyjlCountry( loc );
     if(language && country)
-        translated = oyjlTreeGetStringF_(catalog, 0, "org/freedesktop/oyjl/translations/%s_%s/%s", language, country, key );
-    if(language) free(language);
-    if(country) free(country);
-  }
-  if(!translated)
-  {
-    char * language = oyjlLanguage(loc);
-    translated = oyjlTreeGetStringF_(catalog, 0, "org/freedesktop/oyjl/translations/%s/%s", language, key );
-    if(language) free(language);
-  }
-  if(!translated && text[0])
-  {
-    char * language = oyjlLanguage(loc);
-    char * path = NULL,
-         * plain;
-    char ** paths = NULL;
-    int count, i;
-    char * regex = NULL,
-         * escape = oyjlRegExpEscape( text );
-    oyjlStringAdd( &regex, 0,0, "org/freedesktop/oyjl/translations/%s.*/%s", language, escape );
-    free(escape); escape = NULL;
-
-    paths = oyjlTreeToPaths( catalog, 10000000, NULL, OYJL_KEY | OYJL_NO_ALLOC, &count );
-
-    for(i = 0; i < count; ++i)
-    {
-      path = paths[i];
-      plain = oyjlJsonEscape( path, OYJL_REVERSE | OYJL_REGEXP | OYJL_KEY );
-      if(flags & OYJL_OBSERVE)
-        oyjlMessage_p( oyjlMSG_INFO, 0, OYJL_DBG_FORMAT "\tpath[%d]: \"%s\" regex: \"%s\"", OYJL_DBG_ARGS, i, path, regex );
-      if(oyjlRegExpFind(plain, regex))
-      {
-        char * p = strrchr(plain, '/');
-        if(p) ++p;
-        if(flags & OYJL_OBSERVE)
-          oyjlMessage_p( oyjlMSG_INFO, 0, OYJL_DBG_FORMAT "\tp[%d]: p:\"%s\" text: \"%s\"", OYJL_DBG_ARGS, i, p, text );
-        if(strcmp(p, text) == 0)
-        {
-          path = oyjlStringCopy( path, 0 );
-          p = strrchr(path, '/');
-          if(p) ++p;
-          p[0] = '\000';
-          oyjlStringAdd( &path, 0,0, "%s", key );
-          free(plain);
-          break;
-        }
-      }
-      free(plain);
-    }
-
-    if(paths && count)
-    {
-      if((long)catalog->type == oyjlOBJECT_JSON)
-        free(paths);
-      else
-        oyjlStringListRelease( &paths, count, free );
-    }
-
-    if(i == count)
-      path = NULL;
-
-    v = NULL;
-    if(path)
-    {
-      translated = oyjlTreeGetString_( catalog, 0, path );
-      if(flags & OYJL_OBSERVE)
-        oyjlMessage_p( oyjlMSG_INFO, 0, OYJL_DBG_FORMAT "\tpath:\"%s\" %s", OYJL_DBG_ARGS, path, translated?"found":"not found" );
-      free(path);
-    }
-    if(language) free(language);
-    if(regex) free(regex);
+      translated = oyjlTreeGetStringF2_(catalog, 0, 0, flags, "org/freedesktop/oyjl/translations/%s_%s/%s", language, country, key );
+    if(!translated && language && strcmp(language, loc) != 0)
+      translated = oyjlTreeGetStringF2_(catalog, 0, 0, flags, "org/freedesktop/oyjl/translations/%s/%s", language, key );
+    if(language) free( language );
+    if(country) free( country );
   }
+  if(flags & OYJL_OBSERVE)
+    oyjlMessage_p( oyjlMSG_INFO, 0, OYJL_DBG_FORMAT "\ttext:\"%s\" %s", OYJL_DBG_ARGS, text, translated?"found":"not found" );
 
 oyjlTranslate2_clean:
   if(key) {free(key); key = NULL;}
@@ -2282,6 +3747,9 @@ oyjlTranslate2_clean:
   return translated ? (char*)translated : (char*)text;
 }
 
+/* see oyjlTr_Set() */
+static long oyjl_tr_readers_;
+
 struct oyjl_tr_example_s {
   int start;                           /**< @brief loc start in catalog paths */
   int end;                             /**< @brief loc end in catalog paths */
@@ -2292,10 +3760,12 @@ struct oyjl_tr_example_s {
  *  @param         context             translation variables; optional,
  *                                     will try gettext without
  *  @param         text                the to be translated text; optional, will return without
- *  @return                            translated item; must not be freed
+ *  @return                            translated item; must not be freed;
+ *                                     valid until oyjlTr_Set() replaces
+ *                                     the context
  *
  *  @version Oyjl: 1.0.0
- *  @date    2021/10/24
+ *  @date    2026/10/19
  *  @since   2020/07/27 (Oyjl: 1.0.0)
  */
 char *         oyjlTranslate         ( oyjlTr_s          * context,
@@ -2304,29 +3774,39 @@ char *         oyjlTranslate         ( oyjlTr_s          * context,
   char * translated = NULL;
   const char * lang = "C";
 
+  oyjlAtomicAdd_m( oyjl_tr_readers_, 1 );
   if(context && text)
   {
     oyjl_val catalog = oyjlTr_GetCatalog( context );
     struct oyjl_tr_example_s * bounds = oyjlTr_GetUserData( context );
     const char * domain = oyjlTr_GetDomain( context );
-    int start, end,
+    const struct oyjlTrState_s * state = oyjlTr_GetState_( context );
+    int start = state ? state->start : 0,
+        end = state ? state->end : 0,
         flags = oyjlTr_GetFlags( context );
     if(bounds)
     {
       start = bounds->start;
       end = bounds->end;
-    } else
-    {
-      start = oyjlTr_GetStart_( context );
-      end = oyjlTr_GetEnd_( context );
     }
     if(!catalog)
       flags |= OYJL_GETTEXT;
 
-    lang = oyjlTr_GetLang( context );
+    lang = state ? (state->lang ? state->lang : state->loc) : NULL;
     if(start >= 0 && end >= 0)
-      translated = oyjlTranslate2_( lang, catalog, start, end, domain, text, flags );
+    {
+      struct oyjlTrIndex_s * index = state ? state->index : NULL;
+      if(index && !bounds && !(flags & OYJL_GETTEXT))
+      {
+        translated = (char*) oyjlTrIndexGet_( index, text );
+        if(flags & OYJL_OBSERVE)
+          oyjlMessage_p( oyjlMSG_INFO, 0, OYJL_DBG_FORMAT "text: \"%s\" %s", OYJL_DBG_ARGS, text, translated?"found":"not found" );
+      }
+      else
+        translated = oyjlTranslate2_( lang, catalog, index, start, end, domain, text, flags );
+    }
   }
+  oyjlAtomicAdd_m( oyjl_tr_readers_, -1 );
 
   return translated ? translated : (char*)text;
 }
@@ -2363,14 +3843,225 @@ int  oyjlXPathGetSize_               ( oyjl_val            v,
   return size;
 }
 
+/* deduplicating string pool for oyjlTreeSerialise( OYJL_NESTED ) */
+typedef struct oyjlPool_s
+{
+  char * mem;
+  size_t size;
+  size_t reserved;
+  size_t * slots;                      /* offset + 1 into mem; 0 for empty */
+  size_t slots_n;
+  size_t count;
+} oyjlPool_s;
+
+static int   oyjlPoolGrowSlots_      ( oyjlPool_s        * pool )
+{
+  size_t n = pool->slots_n ? pool->slots_n * 2 : 64, i;
+  size_t * slots = (size_t*) calloc( n, sizeof(size_t) );
+  if(!slots) return 1;
+  for(i = 0; i < pool->slots_n; ++i)
+  {
+    size_t off = pool->slots[i], h;
+    if(!off) continue;
+    h = oyjlNodesChecksum_( pool->mem + off - 1, strlen(pool->mem + off - 1) ) & (n - 1);
+    while(slots[h]) h = (h + 1) & (n - 1);
+    slots[h] = off;
+  }
+  free( pool->slots );
+  pool->slots = slots;
+  pool->slots_n = n;
+  return 0;
+}
+
+/* @return offset of text inside the pool or -1 */
+static long  oyjlPoolAdd_            ( oyjlPool_s        * pool,
+                                       const char        * text )
+{
+  size_t len = strlen(text), h;
+
+  if((pool->count + 1) * 2 > pool->slots_n && oyjlPoolGrowSlots_( pool ))
+    return -1;
+
+  h = oyjlNodesChecksum_( text, len ) & (pool->slots_n - 1);
+  while(pool->slots[h])
+  {
+    const char * t = pool->mem + pool->slots[h] - 1;
+    if(strcmp( t, text ) == 0)
+      return pool->slots[h] - 1;
+    h = (h + 1) & (pool->slots_n - 1);
+  }
+
+  if(pool->size + len + 1 > pool->reserved)
+  {
+    size_t reserved = (pool->reserved + len + 1) * 2;
+    char * mem = (char*) realloc( pool->mem, reserved );
+    if(!mem) return -1;
+    pool->mem = mem;
+    pool->reserved = reserved;
+  }
+  memcpy( pool->mem + pool->size, text, len + 1 );
+  pool->slots[h] = pool->size + 1;
+  pool->size += len + 1;
+  ++pool->count;
+
+  return pool->slots[h] - 1;
+}
+
+/* size of all oyjlNode_s with their offset tables */
+static size_t oyjlNodesTreeGetSize_  ( oyjl_val            v,
+                                       int               * count )
+{
+  size_t size = sizeof(oyjlNode_s), i;
+  ++*count;
+  switch(v->type)
+  {
+    case oyjl_t_number:
+      size += sizeof(oyjlNodeNumber_s);
+      break;
+    case oyjl_t_array:
+      size += sizeof(uint64_t) * v->u.array.len;
+      for(i = 0; i < v->u.array.len; ++i)
+        size += oyjlNodesTreeGetSize_( v->u.array.values[i], count );
+      break;
+    case oyjl_t_object:
+      size += 2 * sizeof(uint64_t) * v->u.object.len;
+      for(i = 0; i < v->u.object.len; ++i)
+        size += oyjlNodesTreeGetSize_( v->u.object.values[i], count );
+      break;
+    default: break;
+  }
+  return size;
+}
+
+/* write v at pos and return the position after its subtree or 0 on error */
+static size_t oyjlNodesTreeWrite_    ( oyjl_val            v,
+                                       char              * block,
+                                       size_t              pos,
+                                       oyjlPool_s        * pool,
+                                       size_t              pool_start )
+{
+  oyjlNode_s * node = (oyjlNode_s *)(block + pos);
+  size_t next = pos + sizeof(oyjlNode_s), i;
+  uint64_t * offsets;
+  long off;
+
+  node->magic = oyjlOBJECT_JSON_NODE;
+  node->type = v->type;
+  switch(v->type)
+  {
+    case oyjl_t_string:
+      off = oyjlPoolAdd_( pool, v->u.string );
+      if(off < 0) return 0;
+      node->data = pool_start + off - pos;
+      break;
+    case oyjl_t_number:
+      {
+        oyjlNodeNumber_s * number = (oyjlNodeNumber_s *)(block + next);
+        number->i = v->u.number.i;
+        number->d = v->u.number.d;
+        off = oyjlPoolAdd_( pool, v->u.number.r ? v->u.number.r : "" );
+        if(off < 0) return 0;
+        number->r = pool_start + off - pos;
+        node->flags = v->u.number.flags & (OYJL_NUMBER_INT_VALID | OYJL_NUMBER_DOUBLE_VALID);
+        node->data = next - pos;
+        next += sizeof(oyjlNodeNumber_s);
+      }
+      break;
+    case oyjl_t_array:
+      node->len = v->u.array.len;
+      node->data = next - pos;
+      next += sizeof(uint64_t) * node->len;
+      for(i = 0; i < node->len; ++i)
+      {
+        offsets = (uint64_t *)(block + pos + node->data);
+        offsets[i] = next - pos;
+        next = oyjlNodesTreeWrite_( v->u.array.values[i], block, next, pool, pool_start );
+        if(!next) return 0;
+      }
+      break;
+    case oyjl_t_object:
+      node->len = v->u.object.len;
+      node->data = next - pos;
+      next += 2 * sizeof(uint64_t) * node->len;
+      for(i = 0; i < node->len; ++i)
+      {
+        offsets = (uint64_t *)(block + pos + node->data);
+        off = oyjlPoolAdd_( pool, v->u.object.keys[i] );
+        if(off < 0) return 0;
+        offsets[2*i] = pool_start + off - pos;
+        offsets[2*i + 1] = next - pos;
+        next = oyjlNodesTreeWrite_( v->u.object.values[i], block, next, pool, pool_start );
+        if(!next) return 0;
+      }
+      break;
+    default: break;
+  }
+
+  return next;
+}
+
+static oyjl_val oyjlTreeSerialiseNested_( oyjl_val         v,
+                                       int                 flags,
+                                       int               * size )
+{
+  oyjlNodesTree_s * tree;
+  oyjlPool_s pool;
+  int count = 0;
+  size_t nodes_size = sizeof(oyjlNodesTree_s) + oyjlNodesTreeGetSize_( v, &count ),
+         size_;
+  char * block = (char*) calloc( nodes_size, sizeof(char) );
+
+  if(!block) return NULL;
+  memset( &pool, 0, sizeof(pool) );
+
+  if(!oyjlNodesTreeWrite_( v, block, sizeof(oyjlNodesTree_s), &pool, nodes_size ))
+  {
+    oyjlMessage_p( oyjlMSG_ERROR, 0, OYJL_DBG_FORMAT "key pool alloc failed: %d strings", OYJL_DBG_ARGS, (int)pool.count );
+    tree = NULL;
+  }
+  else
+    tree = (oyjlNodesTree_s *) realloc( block, nodes_size + pool.size );
+  if(tree)
+  {
+    size_ = nodes_size + pool.size;
+    memcpy( (char*)tree + nodes_size, pool.mem, pool.size );
+    memcpy( tree->type, "oiJT", 4 );
+    tree->count = count;
+    tree->size = size_;
+    tree->pool = nodes_size;
+    tree->pool_size = pool.size;
+    if(size)
+      *size = size_;
+  } else
+    free( block );
+
+  if(flags & OYJL_OBSERVE)
+    oyjlMessage_p( oyjlMSG_INFO, 0, OYJL_DBG_FORMAT "oiJT nodes: %d nodes_size: %d pool: %d strings: %d", OYJL_DBG_ARGS, count, (int)nodes_size, (int)pool.size, (int)pool.count );
+
+  if(pool.mem) free( pool.mem );
+  if(pool.slots) free( pool.slots );
+
+  return (oyjl_val)tree;
+}
+
 #define OYJL_PAD_SIZE( size, modulo ) ((size % modulo) ? (modulo - size % modulo) : 0)
 /** @brief   write tree to data block
+ *
+ *  The default oiJS format is a sorted list of xpath leaves.
+ *  The ::OYJL_NESTED oiJT format keeps objects and arrays as nodes with
+ *  child offset tables and a shared key pool. Its nodes can be navigated
+ *  with oyjlTreeGetValue(), oyjlValueCount(), oyjlValuePosGet(),
+ *  oyjlValuePosGetKey() and read with oyjlValueText().
  *
  *  @param         v                   tree to serialise
  *  @param[in]     flags               supported:
  *                                     - OYJL_OBSERVE : to print verbose info message
+ *                                     - OYJL_NESTED : write oiJT tree layout
  *  @param[out]    size                the size of the returned data block
- *  @return                            serialised tree
+ *  @return                            serialised tree; release with oyjlTreeFree();
+ *                                     free() works too, but keeps the
+ *                                     lookup views until the address is
+ *                                     reused or oyjlLibRelease()
  *
  *  @see oyjlTreeDeSerialise()
  *
@@ -2384,18 +4075,22 @@ oyjl_val   oyjlTreeSerialise         ( oyjl_val            v,
 {
 #define PAD_SIZE 16
   oyjlNodes_s * nodes = NULL;
-  if(v && (long)v->type == oyjlOBJECT_JSON)
+  if(v && ((long)v->type == oyjlOBJECT_JSON || oyjlNodeGet_( v )))
   {
     char * t = oyjlBT(0);
     oyjlMessage_p( oyjlMSG_ERROR, 0, OYJL_DBG_FORMAT "%spassed a already serialised oiJS in", OYJL_DBG_ARGS, t );
     free(t);
   }
   else
+  if(v && flags & OYJL_NESTED)
+    return oyjlTreeSerialiseNested_( v, flags, size );
+  else
   if(v)
   {
     int count = 0, i,
         max_u_size = sizeof(oyjl_val),
         size_ = 0;
+    uint32_t stamp;
     char ** paths = oyjlTreeToPaths( v, 1000000, NULL, OYJL_KEY, &count );
 
     if(flags & OYJL_OBSERVE)
@@ -2409,6 +4104,12 @@ oyjl_val   oyjlTreeSerialise         ( oyjl_val            v,
       oyjl_val val = oyjlTreeGetValue( v, 0, xpath );
       uint32_t v_offset = 0;
       int size__ = size_;
+      if(!val)
+      {
+        oyjlMessage_p( oyjlMSG_ERROR, 0, OYJL_DBG_FORMAT "xpath not found: %s", OYJL_DBG_ARGS, xpath );
+        oyjlStringListRelease( &paths, count, free );
+        return NULL;
+      }
       size_ += oyjlXPathGetSize_( val, xpath, &v_offset );
       size_ += OYJL_PAD_SIZE( size_, PAD_SIZE );
       if(flags & OYJL_OBSERVE)
@@ -2419,7 +4120,11 @@ oyjl_val   oyjlTreeSerialise         ( oyjl_val            v,
       *size = size_;
 
     nodes = (oyjlNodes_s*)calloc(size_, sizeof(char));
-    if(!nodes) return NULL;
+    if(!nodes)
+    {
+      oyjlStringListRelease( &paths, count, free );
+      return NULL;
+    }
     memcpy( nodes, "oiJS", 4 );
 
     size_ = sizeof(oyjlNodes_s) + sizeof(uint64_t) * count;
@@ -2452,7 +4157,10 @@ oyjl_val   oyjlTreeSerialise         ( oyjl_val            v,
           {
             int i = val->u.number.i;
             double d = val->u.number.d;
-            memcpy( node_v, val, max_u_size );
+            /* the pointer to the unparsed number is meaningless in the block */
+            node_v->u.number.i = val->u.number.i;
+            node_v->u.number.d = val->u.number.d;
+            node_v->u.number.flags = val->u.number.flags;
             strcpy( (char*)node_v + sizeof(oyjl_val_s), val->u.number.r );
             if(flags & OYJL_OBSERVE)
               oyjlMessage_p( oyjlMSG_INFO, 0, OYJL_DBG_FORMAT "\t\tnumber.i:%d number.d:%f number.r:%s", OYJL_DBG_ARGS, i, d, (char*)node_v + sizeof(oyjl_val_s) );
@@ -2471,6 +4179,11 @@ oyjl_val   oyjlTreeSerialise         ( oyjl_val            v,
       }
     }
 
+    /* lets oyjlNodesViewsGet_() tell a new block from a free()d one at the same address */
+    stamp = oyjlNodesChecksum_( (const char*)nodes, size_ );
+    if(!stamp) stamp = 1;
+    memcpy( &nodes->type[4], &stamp, sizeof(stamp) );
+
     oyjlStringListRelease( &paths, count, free );
   }
 
@@ -2506,110 +4219,549 @@ const char * oyjlXPath_Print_        ( oyjlXPath_s       * node )
       break;
   }
 
-  return text;
+  return text;
+}
+
+/** @brief   print
+ *
+ *  @param         v                   block to decode
+ *  @param[in]     flags               supported:
+ *                                     - OYJL_OBSERVE : to print verbose info message
+ *  @return                            text
+ *
+ *  @version Oyjl: 1.0.0
+ *  @date    2021/09/17
+ *  @since   2021/09/17 (Oyjl: 1.0.0)
+ */
+char *     oyjlTreeSerialisedPrint_  ( oyjl_val            v,
+                                       int                 flags OYJL_UNUSED )
+{
+  char * text = NULL;
+  if(v && (long)v->type == oyjlOBJECT_JSON)
+  {
+    int count = 0, i;
+    oyjlNodes_s * nodes = (oyjlNodes_s *)v;
+
+    count = nodes->count;
+    oyjlStringAdd( &text, 0,0, "oiJS:\ncount: %d\n", count );
+    for(i = 0; i < count; ++i)
+    {
+      oyjlXPath_s * node = (oyjlXPath_s *)&((char*)nodes)[nodes->offsets[i]];
+      const char * xpath = ((const char*)node) + sizeof(uint32_t);
+      const char * value = oyjlXPath_Print_( node );
+      oyjlStringAdd( &text, 0,0, "%s:%s\n", xpath, value );
+    }
+  }
+
+  return text;
+}
+
+/* add a child for a xpath term without searching existing keys */
+static oyjl_val oyjlTreeAddChild_    ( oyjl_val            parent,
+                                       const char        * term )
+{
+  int pos = -1;
+  oyjl_val child;
+
+  oyjlPathTermGetIndex_( term, &pos );
+  if(pos >= 0)
+  {
+    size_t len;
+    oyjl_val * values;
+    if(parent->type != oyjl_t_array)
+    {
+      oyjlValueClear( parent );
+      memset( &parent->u, 0, sizeof(parent->u) );
+      parent->type = oyjl_t_array;
+    }
+    len = parent->u.array.len;
+    if((size_t)pos < len)
+      return parent->u.array.values[pos];
+    values = (oyjl_val*) realloc( parent->u.array.values, sizeof(oyjl_val) * (pos + 1) );
+    if(!values) return NULL;
+    parent->u.array.values = values;
+    for( ; len <= (size_t)pos; ++len)
+    {
+      values[len] = oyjlValueAlloc_( oyjl_t_null );
+      parent->u.array.len = len + 1;
+      if(!values[len]) return NULL;
+    }
+    child = values[pos];
+  } else
+  {
+    size_t len;
+    oyjl_val * values;
+    char ** keys;
+    if(parent->type != oyjl_t_object)
+    {
+      oyjlValueClear( parent );
+      memset( &parent->u, 0, sizeof(parent->u) );
+      parent->type = oyjl_t_object;
+    }
+    len = parent->u.object.len;
+    values = (oyjl_val*) realloc( parent->u.object.values, sizeof(oyjl_val) * (len + 1) );
+    if(!values) return NULL;
+    parent->u.object.values = values;
+    keys = (char**) realloc( parent->u.object.keys, sizeof(char*) * (len + 1) );
+    if(!keys) return NULL;
+    parent->u.object.keys = keys;
+    child = oyjlValueAlloc_( oyjl_t_null );
+    if(!child) return NULL;
+    if(strchr( term, '\\' ))
+      keys[len] = oyjlJsonEscape( term, OYJL_REVERSE | OYJL_REGEXP | OYJL_KEY );
+    else
+      keys[len] = oyjlStringCopy( term, 0 );
+    values[len] = child;
+    parent->u.object.len = len + 1;
+  }
+
+  return child;
+}
+
+/** @brief   create tree from serialised data block
+ *
+ *  The leaves are rebuilt in one pass. The nodes of the common path
+ *  prefix with the previous leaf are reused, which makes the function
+ *  linear in the number of leaves.
+ *
+ *  @param         v                   serialised tree
+ *  @param[in]     flags               unused:
+ *  @param[in]     size                the size of the data block v - not used
+ *  @return                            serialised tree
+ *
+ *  @see oyjlTreeSerialise()
+ *
+ *  @version Oyjl: 1.0.0
+ *  @date    2021/11/01
+ *  @since   2021/11/01 (Oyjl: 1.0.0)
+ */
+oyjl_val   oyjlTreeDeSerialise       ( oyjl_val            v,
+                                       int                 flags OYJL_UNUSED,
+                                       int                 size OYJL_UNUSED )
+{
+  oyjl_val root = NULL;
+
+  if(v && (long)v->type != oyjlOBJECT_JSON)
+  {
+    char * t = oyjlBT(0);
+    oyjlMessage_p( oyjlMSG_ERROR, 0, OYJL_DBG_FORMAT "%spassed a non serialised oiJS in", OYJL_DBG_ARGS, t );
+    free(t);
+  }
+  else
+  if(v && (long)v->type == oyjlOBJECT_JSON)
+  {
+    int count = 0, i, j, last_n = 0;
+    oyjlNodes_s * nodes = (oyjlNodes_s *)v;
+    char ** last = NULL;
+    oyjl_val * levels = NULL;
+
+    count = nodes->count;
+    if(count)
+      root = oyjlTreeNew("");
+    for(i = 0; i < count; ++i)
+    {
+      oyjlXPath_s * node = (oyjlXPath_s *)&((char*)nodes)[nodes->offsets[i]];
+      const char * xpath = ((const char*)node) + sizeof(uint32_t);
+      const char * text = NULL;
+      uint32_t v_offset = node->v_offset;
+      int max_u_size = sizeof(oyjl_val_s);
+      oyjl_val val = (oyjl_val)((char*)node + v_offset);
+      oyjl_type type = val->type;
+      int n = 0, k = 0;
+      char ** terms = oyjlStringSplit( xpath, '/', &n, malloc );
+      oyjl_val * tmp;
+
+      if(!n) { oyjlStringListRelease( &terms, n, free ); continue; }
+
+      /* the leaves are in tree order; reuse the nodes of the common prefix */
+      while(k < n && k < last_n && strcmp( terms[k], last[k] ) == 0)
+        ++k;
+      if(k == n)
+        --k;
+      tmp = (oyjl_val*) realloc( levels, sizeof(oyjl_val) * n );
+      if(!tmp) { oyjlStringListRelease( &terms, n, free ); break; }
+      levels = tmp;
+      for(j = k; j < n; ++j)
+      {
+        levels[j] = oyjlTreeAddChild_( j ? levels[j-1] : root, terms[j] );
+        if(!levels[j]) break;
+      }
+      oyjlStringListRelease( &last, last_n, free );
+      last = terms; last_n = n;
+      if(j < n) break;
+
+      v = levels[n-1];
+      oyjlValueClear( v );
+      v->type = type;
+      switch(type)
+      {
+      case oyjl_t_null:
+      case oyjl_t_true:
+      case oyjl_t_false:
+        break;
+      case oyjl_t_number:
+        text = (const char*)val + max_u_size;
+        memcpy( v, val, max_u_size );
+        v->u.number.r = oyjlStringCopy( text, 0 );
+        break;
+      case oyjl_t_string:
+        text = (const char*)node + v_offset + sizeof(oyjl_type);
+        oyjlValueSetString( v, text );
+        break;
+      default:
+        break;
+      }
+    }
+    oyjlStringListRelease( &last, last_n, free );
+    if(levels) free( levels );
+  }
+
+  return root;
+}
+
+/* File header in front of a oyjlNodes_s block on disk.
+ *
+ * The oyjlNodes_s block is offset based and can be used in place,
+ * after mapping the file read only into memory. */
+typedef struct oyjlNodesFile_s
+{
+  char type [8];                       /* place 'oiJF' here for oyjl static Json File */
+  uint32_t version;                    /* OYJL_NODES_FILE_VERSION */
+  uint32_t endian;                     /* OYJL_NODES_FILE_ENDIAN as written by the host */
+  uint32_t header_size;                /* distance from oyjlNodesFile_s to oyjlNodes_s */
+  uint32_t val_size;                   /* sizeof(oyjl_val_s) of the writing host */
+  uint32_t checksum;                   /* FNV-1a over the oyjlNodes_s block */
+  uint32_t tr_size;                    /* size of the oyjlTrFile_s table after the padded block; 0 without */
+  uint64_t size;                       /* size of the oyjlNodes_s block */
+} oyjlNodesFile_s;
+#define OYJL_NODES_FILE_VERSION 1
+#define OYJL_NODES_FILE_ENDIAN  0x01020304
+#define OYJL_NODES_FILE_HEADER_SIZE (sizeof(oyjlNodesFile_s) + OYJL_PAD_SIZE( sizeof(oyjlNodesFile_s), PAD_SIZE ))
+
+/* the size is the end of the last oyjlXPath_s */
+static int oyjlNodesGetSize_         ( oyjlNodes_s       * nodes )
+{
+  int size = sizeof(oyjlNodes_s) + sizeof(uint64_t) * nodes->count;
+  size += OYJL_PAD_SIZE( size, PAD_SIZE );
+  if(nodes->count)
+  {
+    oyjlXPath_s * node = (oyjlXPath_s *)&((char*)nodes)[nodes->offsets[nodes->count-1]];
+    oyjl_val val = (oyjl_val)((char*)node + node->v_offset);
+    const char * text = oyjlXPath_Print_( node );
+    size = nodes->offsets[nodes->count-1] + node->v_offset;
+    if(val->type == oyjl_t_number)
+      size += sizeof(oyjl_val_s) + strlen(text) + 1;
+    else if(val->type == oyjl_t_string)
+      size += sizeof(oyjl_type) + strlen(text) + 1;
+    else
+      size += sizeof(oyjl_type);
+    size += OYJL_PAD_SIZE( size, PAD_SIZE );
+  }
+  return size;
+}
+
+/** @brief   write tree as mappable file
+ *
+ *  The file contains a small header followed by the oyjlTreeSerialise()
+ *  block. The header stores a version, the size, a checksum and the
+ *  endianness of the writing host. Use oyjlTreeMapFile() to load it.
+ *  A oiJS block with "org/freedesktop/oyjl/translations" gets a msgid
+ *  hash table appended, which oyjlTr_New() probes in place.
+ *
+ *  @param         v                   tree or already serialised oiJS block
+ *  @param[in]     flags               supported:
+ *                                     - OYJL_OBSERVE : to print verbose info message
+ *  @param[in]     filename            the file to write
+ *  @return                            error: 0 on success
+ *
+ *  @version Oyjl: 1.0.0
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyjl: 1.0.0)
+ */
+int        oyjlTreeSerialiseToFile   ( oyjl_val            v,
+                                       int                 flags,
+                                       const char        * filename )
+{
+  oyjl_val nodes = NULL;
+  oyjlNodesFile_s * header;
+  char * block, * tr = NULL;
+  int size = 0, written;
+  uint32_t tr_size = 0;
+  size_t header_size = OYJL_NODES_FILE_HEADER_SIZE,
+         tr_offset, file_size;
+
+  if(!v || !filename)
+    return -1;
+
+  if((long)v->type == oyjlOBJECT_JSON)
+    size = oyjlNodesGetSize_( (oyjlNodes_s *)v );
+  else if((long)v->type == oyjlOBJECT_JSON_TREE)
+    size = ((oyjlNodesTree_s *)v)->size;
+  else if(oyjlNodeGet_( v ))
+    return -1;
+  else
+  {
+    nodes = oyjlTreeSerialise( v, flags, &size );
+    if(!nodes)
+      return -1;
+    v = nodes;
+  }
+
+  if((long)v->type == oyjlOBJECT_JSON)
+    tr = oyjlTrFileNew_( v, &tr_size );
+  tr_offset = header_size + size + OYJL_PAD_SIZE( size, PAD_SIZE );
+  file_size = tr ? tr_offset + tr_size : header_size + size;
+
+  block = (char*) calloc( file_size, sizeof(char) );
+  if(!block)
+  {
+    if(nodes) free(nodes);
+    if(tr) free(tr);
+    return -1;
+  }
+  header = (oyjlNodesFile_s *)block;
+  memcpy( header->type, "oiJF", 4 );
+  header->version = OYJL_NODES_FILE_VERSION;
+  header->endian = OYJL_NODES_FILE_ENDIAN;
+  header->header_size = header_size;
+  header->val_size = sizeof(oyjl_val_s);
+  header->size = size;
+  memcpy( block + header_size, v, size );
+  header->checksum = oyjlNodesChecksum_( block + header_size, size );
+  if(tr)
+  {
+    header->tr_size = tr_size;
+    memcpy( block + tr_offset, tr, tr_size );
+  }
+
+  if(flags & OYJL_OBSERVE)
+    oyjlMessage_p( oyjlMSG_INFO, 0, OYJL_DBG_FORMAT "%s header: %d size: %d checksum: %u tr_size: %u", OYJL_DBG_ARGS, filename, (int)header_size, size, header->checksum, tr_size );
+
+  written = oyjlWriteFile( filename, block, file_size );
+
+  free( block );
+  if(nodes) free(nodes);
+  if(tr) free(tr);
+
+  return written == (int)file_size ? 0 : 1;
+}
+
+/* oyjlTreeMapFile() blocks with their mapped length */
+typedef struct {
+  oyjl_val v;
+  char * block;
+  size_t block_size;
+  const oyjlTrFile_s * tr;             /* msgid table or NULL */
+} oyjlMapped_s;
+static oyjlMapped_s * oyjl_mapped_ = NULL;
+static int oyjl_mapped_n_ = 0;
+static char oyjl_mapped_lock_ = 0;
+
+static void oyjlMappedFree_          ( char              * block,
+                                       size_t              block_size )
+{
+#ifdef HAVE_POSIX
+  munmap( block, block_size );
+#else
+  (void)block_size;
+  free( block );
+#endif
+}
+
+/** @brief   map a oyjlTreeSerialiseToFile() file into memory
+ *
+ *  The returned oiJS block can be used read only with oyjlTreeGetValue()
+ *  family, oyjlTreeToPaths() and oyjlTranslate() without parsing.
+ *  On POSIX systems the file is mapped and the memory is shared
+ *  between processes through the page cache. The header is always
+ *  checked. Checksumming the whole block touches every page, so it
+ *  is only done with ::OYJL_VERIFY. A appended msgid table is used by
+ *  oyjlTr_New() for lookups without a pass over the catalog.
+ *  Release with oyjlTreeUnmapFile() and not with oyjlTreeFree().
+ *
+ *  @param[in]     filename            the file to read
+ *  @param[in]     flags               supported:
+ *                                     - OYJL_OBSERVE : to print verbose info message
+ *                                     - OYJL_QUIET : omit error messages
+ *                                     - OYJL_VERIFY : compare the checksum
+ *  @param[out]    size                the size of the oiJS block
+ *  @return                            oiJS block or NULL
+ *
+ *  @version Oyjl: 1.0.0
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyjl: 1.0.0)
+ */
+oyjl_val   oyjlTreeMapFile           ( const char        * filename,
+                                       int                 flags,
+                                       int               * size )
+{
+  char * block = NULL;
+  size_t block_size = 0;
+  const oyjlNodesFile_s * header;
+  const oyjlTrFile_s * tr = NULL;
+  const char * error = NULL;
+  size_t header_size = OYJL_NODES_FILE_HEADER_SIZE;
+
+  if(!filename)
+    return NULL;
+
+#ifdef HAVE_POSIX
+  {
+    struct stat st;
+    int fd = open( filename, O_RDONLY );
+    if(fd < 0)
+    {
+      if(!(flags & OYJL_QUIET))
+        oyjlMessage_p( oyjlMSG_ERROR, 0, OYJL_DBG_FORMAT "Could not open: %s %s", OYJL_DBG_ARGS, filename, strerror(errno) );
+      return NULL;
+    }
+    if(fstat( fd, &st ) == 0 && st.st_size >= (off_t)header_size)
+    {
+      block_size = st.st_size;
+      block = (char*) mmap( NULL, block_size, PROT_READ, MAP_SHARED, fd, 0 );
+      if(block == MAP_FAILED)
+        block = NULL;
+    }
+    close( fd );
+  }
+#else
+  {
+    int s = 0;
+    block = oyjlReadFile( filename, &s );
+    block_size = s > 0 ? s : 0;
+  }
+#endif
+
+  if(!block || block_size < header_size)
+    error = "too small";
+  else
+  {
+    header = (const oyjlNodesFile_s *)block;
+    if(memcmp( header->type, "oiJF", 4 ) != 0)
+      error = "no oiJF header";
+    else if(header->endian != OYJL_NODES_FILE_ENDIAN)
+      error = "wrong endianness";
+    else if(header->version != OYJL_NODES_FILE_VERSION)
+      error = "unsupported version";
+    else if(header->header_size != header_size ||
+            header->val_size != sizeof(oyjl_val_s))
+      error = "incompatible layout";
+    else if(header->size + header_size > block_size)
+      error = "truncated";
+    else if(memcmp( block + header_size, "oiJS", 4 ) != 0 &&
+            memcmp( block + header_size, "oiJT", 4 ) != 0)
+      error = "no oiJS block";
+    else if(flags & OYJL_VERIFY &&
+            oyjlNodesChecksum_( block + header_size, header->size ) != header->checksum)
+      error = "checksum mismatch";
+    else if(header->tr_size)
+    {
+      size_t tr_offset = header_size + header->size + OYJL_PAD_SIZE( header->size, PAD_SIZE );
+      if(memcmp( block + header_size, "oiJS", 4 ) != 0 ||
+         tr_offset + header->tr_size > block_size ||
+         oyjlTrFileCheck_( block + tr_offset, header->tr_size ))
+        error = "broken msgid table";
+      else
+        tr = (const oyjlTrFile_s *)(block + tr_offset);
+    }
+  }
+
+  if(!error)
+  {
+    oyjlMapped_s * tmp;
+    oyjlAtomicLock_m( oyjl_mapped_lock_ );
+    tmp = (oyjlMapped_s*) realloc( oyjl_mapped_, sizeof(oyjlMapped_s) * (oyjl_mapped_n_ + 1) );
+    if(tmp)
+    {
+      oyjl_mapped_ = tmp;
+      oyjl_mapped_[oyjl_mapped_n_].v = (oyjl_val)(block + header_size);
+      oyjl_mapped_[oyjl_mapped_n_].block = block;
+      oyjl_mapped_[oyjl_mapped_n_].block_size = block_size;
+      oyjl_mapped_[oyjl_mapped_n_].tr = tr;
+      ++oyjl_mapped_n_;
+    } else
+      error = "alloc failed";
+    oyjlAtomicUnlock_m( oyjl_mapped_lock_ );
+  }
+
+  if(error)
+  {
+    if(!(flags & OYJL_QUIET))
+      oyjlMessage_p( oyjlMSG_ERROR, 0, OYJL_DBG_FORMAT "%s: %s", OYJL_DBG_ARGS, filename, error );
+    if(block)
+      oyjlMappedFree_( block, block_size );
+    return NULL;
+  }
+
+  if(size)
+    *size = header->size;
+  if(flags & OYJL_OBSERVE)
+    oyjlMessage_p( oyjlMSG_INFO, 0, OYJL_DBG_FORMAT "%s size: %d checksum: %u", OYJL_DBG_ARGS, filename, (int)header->size, header->checksum );
+
+  return (oyjl_val)(block + header_size);
 }
 
-/** @brief   print
- *
- *  @param         v                   block to decode
- *  @param[in]     flags               supported:
- *                                     - OYJL_OBSERVE : to print verbose info message
- *  @return                            text
- *
- *  @version Oyjl: 1.0.0
- *  @date    2021/09/17
- *  @since   2021/09/17 (Oyjl: 1.0.0)
- */
-char *     oyjlTreeSerialisedPrint_  ( oyjl_val            v,
-                                       int                 flags OYJL_UNUSED )
+/* msgid table of a oyjlTreeMapFile() block */
+static const oyjlTrFile_s * oyjlTreeMappedTrFile_( oyjl_val v )
 {
-  char * text = NULL;
-  if(v && (long)v->type == oyjlOBJECT_JSON)
-  {
-    int count = 0, i;
-    oyjlNodes_s * nodes = (oyjlNodes_s *)v;
+  const oyjlTrFile_s * tr = NULL;
+  int i;
 
-    count = nodes->count;
-    oyjlStringAdd( &text, 0,0, "oiJS:\ncount: %d\n", count );
-    for(i = 0; i < count; ++i)
+  if(!v || (long)v->type != oyjlOBJECT_JSON)
+    return NULL;
+
+  oyjlAtomicLock_m( oyjl_mapped_lock_ );
+  for(i = 0; i < oyjl_mapped_n_; ++i)
+    if(oyjl_mapped_[i].v == v)
     {
-      oyjlXPath_s * node = (oyjlXPath_s *)&((char*)nodes)[nodes->offsets[i]];
-      const char * xpath = ((const char*)node) + sizeof(uint32_t);
-      const char * value = oyjlXPath_Print_( node );
-      oyjlStringAdd( &text, 0,0, "%s:%s\n", xpath, value );
+      tr = oyjl_mapped_[i].tr;
+      break;
     }
-  }
+  oyjlAtomicUnlock_m( oyjl_mapped_lock_ );
 
-  return text;
+  return tr;
 }
 
-/** @brief   create tree from serialised data block
- *
- *  @param         v                   serialised tree
- *  @param[in]     flags               unused:
- *  @param[in]     size                the size of the data block v - not used
- *  @return                            serialised tree
+/** @brief   release a oyjlTreeMapFile() block
  *
- *  @see oyjlTreeSerialise()
+ *  Pointers, which do not come from oyjlTreeMapFile(), are ignored.
  *
  *  @version Oyjl: 1.0.0
- *  @date    2021/11/01
- *  @since   2021/11/01 (Oyjl: 1.0.0)
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyjl: 1.0.0)
  */
-oyjl_val   oyjlTreeDeSerialise       ( oyjl_val            v,
-                                       int                 flags OYJL_UNUSED,
-                                       int                 size OYJL_UNUSED )
+void       oyjlTreeUnmapFile         ( oyjl_val            v )
 {
-  oyjl_val root = NULL;
+  char * block = NULL;
+  size_t block_size = 0;
+  int i;
 
-  if(v && (long)v->type != oyjlOBJECT_JSON)
-  {
-    char * t = oyjlBT(0);
-    oyjlMessage_p( oyjlMSG_ERROR, 0, OYJL_DBG_FORMAT "%spassed a non serialised oiJS in", OYJL_DBG_ARGS, t );
-    free(t);
-  }
-  else
-  if(v && (long)v->type == oyjlOBJECT_JSON)
-  {
-    int count = 0, i;
-    oyjlNodes_s * nodes = (oyjlNodes_s *)v;
+  if(!v)
+    return;
 
-    count = nodes->count;
-    if(count)
-      root = oyjlTreeNew("");
-    for(i = 0; i < count; ++i)
+  oyjlAtomicLock_m( oyjl_mapped_lock_ );
+  for(i = 0; i < oyjl_mapped_n_; ++i)
+    if(oyjl_mapped_[i].v == v)
     {
-      oyjlXPath_s * node = (oyjlXPath_s *)&((char*)nodes)[nodes->offsets[i]];
-      const char * xpath = ((const char*)node) + sizeof(uint32_t);
-      const char * text = NULL;
-      uint32_t v_offset = node->v_offset;
-      int max_u_size = sizeof(oyjl_val_s);
-      oyjl_val val = (oyjl_val)((char*)node + v_offset);
-      oyjl_type type = val->type;
-      v = oyjlTreeGetValue( root, OYJL_CREATE_NEW, xpath );
-      v->type = type;
-      switch(type)
-      {
-      case oyjl_t_null:
-      case oyjl_t_true:
-      case oyjl_t_false:
-        break;
-      case oyjl_t_number:
-        text = (const char*)val + max_u_size;
-        memcpy( v, val, max_u_size );
-        v->u.number.r = oyjlStringCopy( text, 0 );
-        break;
-      case oyjl_t_string:
-        text = (const char*)node + v_offset + sizeof(oyjl_type);
-        oyjlValueSetString( v, text );
-        break;
-      default:
-        break;
-      }
+      block = oyjl_mapped_[i].block;
+      block_size = oyjl_mapped_[i].block_size;
+      oyjl_mapped_[i] = oyjl_mapped_[--oyjl_mapped_n_];
+      break;
     }
+  if(!oyjl_mapped_n_ && oyjl_mapped_)
+  {
+    free( oyjl_mapped_ );
+    oyjl_mapped_ = NULL;
   }
+  oyjlAtomicUnlock_m( oyjl_mapped_lock_ );
 
-  return root;
+  if(!block)
+    return;
+
+  if((long)v->type == oyjlOBJECT_JSON)
+    oyjlNodesViewsRelease_( v );
+
+  oyjlMappedFree_( block, block_size );
 }
 
 const char * oyjlTreeGetString2_     ( oyjl_val            v,
@@ -2726,6 +4878,8 @@ const char*oyjlTreeGetStringF_       ( oyjl_val            v,
 }
 
 
+/* Catalog paths list each language as one block, so a new language
+ * starts where the loc term differs from the one of the previous path. */
 char **  oyjlCatalogGetLangs_        ( char             ** paths,
                                        int                 count,
                                        int               * langs_n,
@@ -2736,40 +4890,56 @@ char **  oyjlCatalogGetLangs_        ( char             ** paths,
 
   if(paths && count)
   {
+    const char * base = "org/freedesktop/oyjl/translations/";
+    int base_len = strlen(base);
+    const char * prev = NULL;
+    size_t prev_len = 0;
     int i,j;
-    int locs_n = 0;
+    int locs_n = 0, reserved = 0;
     for(i = 0; i < count; ++i)
     {
-      const char * path = paths[i];
-      int len = strlen(path);
-      const char * base = "org/freedesktop/oyjl/translations/";
-      int base_len = strlen(base);
+      const char * path = paths[i], * term, * end;
+      size_t len;
       char * loc, * t;
       int found = 0;
 
-      if(!strstr(path, base))
+      if(!path || strncmp(path, base, base_len) != 0)
         continue;
-      loc = len > base_len ? oyjlStringCopy(&path[base_len], 0) : NULL;
+      term = path + base_len;
+      end = strchr(term, '/');
+      len = end ? (size_t)(end - term) : strlen(term);
+      if(!len)
+        continue;
+      if(prev && len == prev_len && memcmp(prev, term, len) == 0)
+        continue;
+      prev = term;
+      prev_len = len;
+
+      loc = oyjlStringAppendN( NULL, term, len, malloc );
       if(!loc)
         continue;
-      t = loc ? strrchr(loc, '/') : NULL;
-      if(t) t[0] = '\000';
-      t = oyjlJsonEscape( loc, OYJL_REVERSE | OYJL_REGEXP | OYJL_KEY );
-      if(loc) { free(loc); loc = NULL; }
-      loc = t;
-      for(j = 0; j < locs_n; ++j)
+      if(strchr(loc, '\\') || strchr(loc, '%'))
       {
-        char * l = locs[j];
-        if(!loc || strcmp(l, loc) == 0)
+        t = oyjlJsonEscape( loc, OYJL_REVERSE | OYJL_REGEXP | OYJL_KEY );
+        free(loc);
+        loc = t;
+      }
+      for(j = 0; loc && j < locs_n; ++j)
+        if(strcmp(locs[j], loc) == 0)
         {
           found = 1;
           break;
         }
-      }
-      if(found == 0)
+      if(loc && found == 0)
       {
-        if(!locs_start)
-          oyjlAllocHelper_m( locs_start, int, 1024, malloc, return NULL );
+        if(locs_n >= reserved)
+        {
+          int * tmp;
+          reserved = reserved ? reserved * 2 : 16;
+          tmp = (int*) realloc( locs_start, reserved * sizeof(int) );
+          if(!tmp) { free(loc); break; }
+          locs_start = tmp;
+        }
         locs_start[locs_n] = i;
         oyjlStringListAddString( &locs, &locs_n, loc, malloc,free );
       }
@@ -2780,6 +4950,8 @@ char **  oyjlCatalogGetLangs_        ( char             ** paths,
       *langs_n = locs_n;
     if(lang_positions_start)
       *lang_positions_start = locs_start;
+    else if(locs_start)
+      free(locs_start);
   }
 
   return locs;
@@ -2827,10 +4999,17 @@ char *             oyjlLangForCatalog_(const char        * loc,
 
   if(catalog)
   {
-    int count, i,j;
-    char ** paths = oyjlTreeToPaths( catalog, 10000000, NULL, OYJL_KEY | OYJL_NO_ALLOC, &count );
+    int count = 0, i,j;
+    /* a mapped oiJF table lists the langs already */
+    const oyjlTrFile_s * file = oyjlTreeMappedTrFile_( catalog );
+    char ** paths = NULL;
 
-    if(paths && count)
+    if(file)
+      count = ((oyjlNodes_s *)catalog)->count;
+    else
+      paths = oyjlTreeToPaths( catalog, 10000000, NULL, OYJL_KEY | OYJL_NO_ALLOC, &count );
+
+    if((paths || file) && count)
     {
       int opt_start = 0,
           opt_end = count;
@@ -2842,8 +5021,11 @@ char *             oyjlLangForCatalog_(const char        * loc,
       char ** langs = NULL;
       char * language = oyjlLanguage( loc );
 
-      langs = oyjlCatalogGetLangs_( paths, count,
-                                    &langs_n, &lang_positions_start );
+      if(file)
+        langs = oyjlTrFileGetLangs_( file, &langs_n, &lang_positions_start );
+      else
+        langs = oyjlCatalogGetLangs_( paths, count,
+                                      &langs_n, &lang_positions_start );
       for(j = 0; j < langs_n; ++j)
       {
         char * l = langs[j];
@@ -2920,6 +5102,57 @@ char *             oyjlLangForCatalog_(const char        * loc,
   return new_loc;
 }
 
+/* translate the string members of v, whose key is in keys; recurses into containers */
+static void      oyjlTranslateJson_  ( oyjl_val            v,
+                                       oyjlTr_s          * context,
+                                       oyjlTranslate_f     translator,
+                                       const char       ** keys,
+                                       int                 n )
+{
+  size_t i, count;
+  int j;
+
+  if(!v) return;
+
+  if(v->type == oyjl_t_array)
+  {
+    count = v->u.array.len;
+    for(i = 0; i < count; ++i)
+      oyjlTranslateJson_( v->u.array.values[i], context, translator, keys, n );
+  }
+  else if(v->type == oyjl_t_object)
+  {
+    count = v->u.object.len;
+    for(i = 0; i < count; ++i)
+    {
+      oyjl_val member = v->u.object.values[i];
+      const char * name = v->u.object.keys[i];
+
+      if(!member) continue;
+      if(member->type != oyjl_t_string)
+      {
+        oyjlTranslateJson_( member, context, translator, keys, n );
+        continue;
+      }
+      if(!name) continue;
+
+      for(j = 0; j < n; ++j)
+        if(keys[j][0] == name[0] && strcmp( keys[j], name ) == 0)
+          break;
+      if(j < n && member->u.string)
+      {
+        const char * t = member->u.string;
+        const char * i18n = translator( context, t );
+        int error = 0;
+        if(i18n && strcmp(i18n,t) != 0)
+          error = oyjlValueSetString( member, i18n );
+        if(error)
+          oyjlMessage_p( oyjlMSG_ERROR, 0, OYJL_DBG_FORMAT "text: %s", OYJL_DBG_ARGS, t );
+      }
+    }
+  }
+}
+
 /** @brief   translate JSON
  *
  *  @see oyjlUi_Translate() oyjlTr_New()
@@ -2930,17 +5163,18 @@ char *             oyjlLangForCatalog_(const char        * loc,
  *  @param[in]     key_list           comma separate list of keys to translate; optional, without the function will return
  *
  *  @version Oyjl: 1.0.0
- *  @date    2021/10/24
+ *  @date    2026/10/19
  *  @since   2021/07/09 (Oyjl: 1.0.0)
  */
 void               oyjlTranslateJson ( oyjl_val            root,
                                        oyjlTr_s          * context,
                                        const char        * key_list )
 {
-  if(root)
+  if(root && key_list && key_list[0])
   {
-    int count = 0, i;
-    char ** paths = oyjlTreeToPaths( root, 1000000, NULL,  OYJL_KEY, &count );
+    int n = 0, i;
+    char ** list = oyjlStringSplit( key_list, ',', &n, malloc );
+    const char ** keys = list && n ? (const char**) calloc( n, sizeof(const char*) ) : NULL;
     oyjlTranslate_f translator = NULL;
 
     if(!context)
@@ -2950,43 +5184,18 @@ void               oyjlTranslateJson ( oyjl_val            root,
     if(!translator)
       translator = oyjlTranslate;
 
-    if(count)
+    if(keys)
     {
-      int n = 0;
-      char ** list = oyjlStringSplit( key_list, ',', &n, malloc );
-
-      for(i = 0; i < count; ++i)
+      /* a key matches a member by its last path term */
+      for(i = 0; i < n; ++i)
       {
-        const char * path = paths[i];
-        int j;
-        const char * p = strrchr(path, '/');
-        if(p) ++p;
-        if(p && strstr(key_list, p))
-        for(j = 0; j < n; ++j)
-        {
-          const char * key = list[j];
-          if(oyjlPathMatch(path, key, OYJL_PATH_MATCH_LAST_ITEMS ))
-          {
-            const char * t = NULL;
-            oyjl_val v = oyjlTreeGetValue( root, 0, path );
-            if(v)
-              t = OYJL_GET_STRING(v);
-            if(t)
-            {
-              int error = 0;
-              const char * i18n = translator( context, t );
-              if(i18n && t && strcmp(i18n,t) != 0)
-                error = oyjlValueSetString(v,i18n);
-              if(error)
-                oyjlMessage_p( oyjlMSG_ERROR, 0, OYJL_DBG_FORMAT "text: %s", OYJL_DBG_ARGS, t );
-              break;
-            }
-          }
-        }
+        const char * term = strrchr( list[i], '/' );
+        keys[i] = term ? term + 1 : list[i];
       }
-      oyjlStringListRelease( &list, n, free );
+      oyjlTranslateJson_( root, context, translator, keys, n );
+      free( keys );
     }
-    oyjlStringListRelease( &paths, count, free );
+    oyjlStringListRelease( &list, n, free );
   }
 }
 
@@ -3000,23 +5209,59 @@ void               oyjlTranslateJson ( oyjl_val            root,
 struct oyjlTr_s
 {
   char type [8];                       /**< @brief must be 'oitr' */
-  const char * loc;                    /**< @brief original provided locale */
-  char * lang;                         /**< @brief optimised loc for translator */
+  struct oyjlTrState_s * state;        /**< @brief loc, lang and index; swapped by oyjlTr_SetLocale() */
+  struct oyjlTrState_s * states;       /**< @brief all resolved states, newest first */
   const char * domain;                 /**< @brief identiefier for catalog */
   oyjl_val catalog;                    /**< @brief the translation tables */
-  int start;                           /**< @brief lang start in catalog paths */
-  int end;                             /**< @brief lang end in catalog paths */
   oyjlTranslate_f translator;          /**< @brief the function */
   void * user_data;                    /**< @brief additional data for translator */
   void (*deAlloc)(void*);              /**< @brief custom deallocator; optional */
   int flags;                           /**< @brief flags for translator; optional */
+  int mapped;                          /**< @brief catalog from oyjlTreeMapFile() */
+  char lock;                           /**< @brief serialise oyjlTr_SetLocale() */
 };
 
+static struct oyjlTrState_s * oyjlTrStateNew_( oyjl_val    catalog,
+                                       const char        * loc,
+                                       int                 flags )
+{
+  struct oyjlTrState_s * state = (struct oyjlTrState_s*) calloc( 1, sizeof(struct oyjlTrState_s) );
+  if(!state) return NULL;
+  state->loc = loc ? oyjlStringCopy( loc, 0 ) : NULL;
+  state->lang = oyjlLangForCatalog_( loc, catalog, &state->start, &state->end, flags );
+  state->index = oyjlTrIndexNew_( catalog, state->lang ? state->lang : loc );
+  return state;
+}
+
+/* release state together with all older states */
+static void  oyjlTrStateRelease_     ( struct oyjlTrState_s ** state_ )
+{
+  struct oyjlTrState_s * state = *state_;
+  while(state)
+  {
+    struct oyjlTrState_s * next = state->next;
+    if(state->loc) free(state->loc);
+    if(state->lang) free(state->lang);
+    oyjlTrIndexRelease_( &state->index );
+    free(state);
+    state = next;
+  }
+  *state_ = NULL;
+}
+
 /** @brief create i18n context 
  *
  *  The passed in catalog shall contain its translations in the
  *  "org/freedesktop/oyjl/translations/loc" path.
  *
+ *  A catalog written with oyjl-translate -w oiJF can be loaded without
+ *  parsing. Its msgid table is probed in place, so no pass over the
+ *  catalog is needed:
+ *  @code
+    oyjl_val catalog = oyjlTreeMapFile( "my-app.oiJF", 0, NULL );
+    oyjlTr_s * trc = oyjlTr_New( loc, "my-app", &catalog, 0,0,0, OYJL_MAPPED );
+    @endcode
+ *
  *  @param         loc                 locale name as from setlocale(0,""), the special locale "back" will inverse the translation; optional
  *  @param         translator          the function; optional
  *  @param         catalog             the parsed catalog as tree; optional
@@ -3027,10 +5272,13 @@ struct oyjlTr_s
  *                                       message
  *                                     - ::OYJL_GETTEXT: force gettext API
  *                                     - ::OYJL_NO_OPTIMISE
+ *                                     - ::OYJL_MAPPED: catalog is from
+ *                                       oyjlTreeMapFile() and will be
+ *                                       released with oyjlTreeUnmapFile()
  *  @return                            context
  *
  *  @version Oyjl: 1.0.0
- *  @date    2021/10/26
+ *  @date    2026/10/19
  *  @since   2021/10/24 (Oyjl: 1.0.0)
  */
 oyjlTr_s *     oyjlTr_New            ( const char        * loc,
@@ -3042,11 +5290,9 @@ oyjlTr_s *     oyjlTr_New            ( const char        * loc,
                                        int                 flags )
 {
   oyjlTr_s * context = NULL;
-  char * lang = NULL;
 
   oyjlAllocHelper_m( context, struct oyjlTr_s, 1, malloc, return NULL );
   memcpy( context->type, "oitr", 4 );
-  context->loc = loc;
   context->domain = domain;
   if(*oyjl_debug > 1)
     fprintf(stderr, OYJL_DBG_FORMAT "loc: %s domain: %s\n", OYJL_DBG_ARGS, loc, domain );
@@ -3055,14 +5301,12 @@ oyjlTr_s *     oyjlTr_New            ( const char        * loc,
     context->catalog = *catalog;
     *catalog = NULL;
   }
+  context->mapped = context->catalog && flags & OYJL_MAPPED;
   context->translator = translator;
   context->user_data = user_data;
   context->deAlloc = deAlloc;
-  context->flags = flags;
-  lang  = oyjlLangForCatalog_( loc, context->catalog,
-                                    &context->start, &context->end,
-                                    context->flags );
-  context->lang = lang;
+  context->flags = flags & (~OYJL_MAPPED);
+  context->state = context->states = oyjlTrStateNew_( context->catalog, loc, context->flags );
 
   return context;
 }
@@ -3105,7 +5349,8 @@ oyjlTranslate_f oyjlTr_GetTranslator ( oyjlTr_s          * context )
  */
 const char * oyjlTr_GetLang          ( oyjlTr_s          * context )
 {
-  return context && oyjlTr_Check_(context) && context->lang ? context->lang : context?context->loc:NULL;
+  const struct oyjlTrState_s * state = oyjlTr_GetState_( context );
+  return state ? (state->lang ? state->lang : state->loc) : NULL;
 }
 
 /** @brief get domain
@@ -3161,7 +5406,8 @@ int          oyjlTr_GetFlags         ( oyjlTr_s          * context )
  */
 int          oyjlTr_GetStart_        ( oyjlTr_s          * context )
 {
-  return context && oyjlTr_Check_(context) ? context->start : 0;
+  const struct oyjlTrState_s * state = oyjlTr_GetState_( context );
+  return state ? state->start : 0;
 }
 
 /** @brief get end
@@ -3173,7 +5419,35 @@ int          oyjlTr_GetStart_        ( oyjlTr_s          * context )
  */
 int          oyjlTr_GetEnd_          ( oyjlTr_s          * context )
 {
-  return context && oyjlTr_Check_(context) ? context->end : 0;
+  const struct oyjlTrState_s * state = oyjlTr_GetState_( context );
+  return state ? state->end : 0;
+}
+
+/** @brief get msgid hash
+ *  @internal
+ *
+ *  @version Oyjl: 1.0.0
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyjl: 1.0.0)
+ */
+struct oyjlTrIndex_s * oyjlTr_GetIndex_( oyjlTr_s        * context )
+{
+  const struct oyjlTrState_s * state = oyjlTr_GetState_( context );
+  return state ? state->index : NULL;
+}
+
+/** @brief get the current locale state
+ *  @internal
+ *
+ *  The state is immutable and can be read without lock.
+ *
+ *  @version Oyjl: 1.0.0
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyjl: 1.0.0)
+ */
+const struct oyjlTrState_s * oyjlTr_GetState_( oyjlTr_s  * context )
+{
+  return context && oyjlTr_Check_(context) ? oyjlAtomicGet_m( context->state ) : NULL;
 }
 
 /** @brief   change flags
@@ -3193,12 +5467,17 @@ void           oyjlTr_SetFlags       ( oyjlTr_s          * context,
 }
 /** @brief   change language
 *
+*  The new language is published at once. oyjlTranslate() calls on other
+*  threads continue with the old or the new language without locking.
+*  Each loc is resolved against the catalog only once per context;
+*  switching back to a loc used before reuses that result.
+*
 *  @param          context            the translation context
 *  @param          loc                locale name as from setlocale("")
 *                                     - "something": set lang to "something"
 *
 *  @version Oyjl: 1.0.0
-*  @date    2021/10/24
+*  @date    2026/10/19
 *  @since   2021/10/24 (Oyjl: 1.0.0)
 */
 void           oyjlTr_SetLocale      ( oyjlTr_s          * context,
@@ -3206,14 +5485,36 @@ void           oyjlTr_SetLocale      ( oyjlTr_s          * context,
 {
   if(context && oyjlTr_Check_(context) && loc && loc[0])
   {
-    context->loc = loc;
-    context->start = 0;
-    context->end = 0;
-    if(context->lang)
-      free(context->lang);
-    context->lang  = oyjlLangForCatalog_( loc, context->catalog,
-                                          &context->start, &context->end,
-                                          context->flags );
+    struct oyjlTrState_s * state, * new_state = NULL;
+    int pass;
+
+    /* the catalog does not change, so the same loc gives the same state;
+     * a new state is resolved outside the lock and only linked under it */
+    for(pass = 0; pass < 2; ++pass)
+    {
+      oyjlAtomicLock_m( context->lock );
+      for(state = context->states; state; state = state->next)
+        if(state->loc && strcmp( state->loc, loc ) == 0)
+          break;
+      if(!state && new_state)
+      {
+        state = new_state;
+        state->next = context->states;
+        context->states = state;
+        new_state = NULL;
+      }
+      if(state && state != context->state)
+        oyjlAtomicSet_m( context->state, state );
+      oyjlAtomicUnlock_m( context->lock );
+
+      if(state || pass)
+        break;
+      new_state = oyjlTrStateNew_( context->catalog, loc, context->flags );
+      if(!new_state)
+        break;
+    }
+    /* an other thread resolved the same loc meanwhile */
+    oyjlTrStateRelease_( &new_state );
   }
 }
 
@@ -3230,21 +5531,20 @@ void           oyjlTr_Release        ( oyjlTr_s         ** context_ )
     return;
 
   context = *context_;
-  context->loc = NULL;
-  if(context->catalog)
+  if(context->catalog && context->mapped)
+    oyjlTreeUnmapFile( context->catalog );
+  else if(context->catalog)
     oyjlTreeFree( context->catalog );
   context->catalog = NULL;
+  context->mapped = 0;
   context->translator = NULL;
   if(context->deAlloc)
     context->deAlloc( context->user_data );
   context->user_data = NULL;
   context->deAlloc = NULL;
   context->flags = 0;
-  context->start = 0;
-  context->end = 0;
-  if(context->lang)
-    free(context->lang);
-  context->lang = NULL;
+  context->state = NULL;
+  oyjlTrStateRelease_( &context->states );
   free(context);
   context = NULL;
 
@@ -3254,6 +5554,93 @@ void           oyjlTr_Release        ( oyjlTr_s         ** context_ )
 
 
 oyjlTr_s ** oyjl_tr_context_ = NULL;
+int         oyjl_tr_context_reserve_ = 0;
+/* serialises registry writers; readers load oyjl_tr_context_ once and
+ * walk the NULL terminated array without lock */
+static char oyjl_tr_lock_ = 0;
+/* replaced registry arrays and contexts, which readers might still use */
+typedef struct {
+  void * ptr;
+  int is_context;
+  int age;                             /* oyjlTrRetiredFree_() calls seen */
+} oyjlTrRetired_s;
+static oyjlTrRetired_s * oyjl_tr_retired_ = NULL;
+static int oyjl_tr_retired_n_ = 0;
+/* threads walking a registry array or using a context; counted by
+ * oyjlTr_Get(), oyjlLang() and oyjlTranslate() */
+static long oyjl_tr_readers_ = 0;
+static void  oyjlTrRetire_           ( void              * ptr,
+                                       int                 is_context )
+{
+  oyjlTrRetired_s * tmp = (oyjlTrRetired_s*) realloc( oyjl_tr_retired_, sizeof(oyjlTrRetired_s) * (oyjl_tr_retired_n_ + 1) );
+  /* rather leak than free under a reader */
+  if(!tmp)
+    return;
+  oyjl_tr_retired_ = tmp;
+  oyjl_tr_retired_[oyjl_tr_retired_n_].ptr = ptr;
+  oyjl_tr_retired_[oyjl_tr_retired_n_].is_context = is_context;
+  oyjl_tr_retired_[oyjl_tr_retired_n_].age = 0;
+  ++oyjl_tr_retired_n_;
+}
+/* free replaced arrays and contexts, when no reader uses them; call under
+ * oyjl_tr_lock_ after publishing: a reader counted later loads the new
+ * array already. A context is kept for one more call, as _() counts
+ * oyjlTr_Get() and oyjlTranslate() separately and the pointer passes
+ * uncounted in between. */
+static void  oyjlTrRetiredFree_      ( void )
+{
+  int i, n = 0;
+  if(oyjlAtomicAdd_m( oyjl_tr_readers_, 0 ) != 0)
+    return;
+  for(i = 0; i < oyjl_tr_retired_n_; ++i)
+  {
+    if(oyjl_tr_retired_[i].is_context && oyjl_tr_retired_[i].age++ == 0)
+      oyjl_tr_retired_[n++] = oyjl_tr_retired_[i];
+    else if(oyjl_tr_retired_[i].is_context)
+    {
+      oyjlTr_s * context = (oyjlTr_s*) oyjl_tr_retired_[i].ptr;
+      oyjlTr_Release( &context );
+    }
+    else
+      free( oyjl_tr_retired_[i].ptr );
+  }
+  oyjl_tr_retired_n_ = n;
+}
+
+/* release registered and retired contexts; call without concurrent readers */
+void       oyjlTrRegistryRelease_    ( void )
+{
+  int i;
+
+  oyjlAtomicLock_m( oyjl_tr_lock_ );
+  if(oyjl_tr_context_)
+  {
+    i = 0;
+    while(oyjl_tr_context_[i])
+    {
+      oyjlTr_Release( &oyjl_tr_context_[i] );
+      ++i;
+    }
+    free(oyjl_tr_context_);
+    oyjl_tr_context_ = NULL;
+    oyjl_tr_context_reserve_ = 0;
+  }
+  for(i = 0; i < oyjl_tr_retired_n_; ++i)
+  {
+    if(oyjl_tr_retired_[i].is_context)
+    {
+      oyjlTr_s * context = (oyjlTr_s*) oyjl_tr_retired_[i].ptr;
+      oyjlTr_Release( &context );
+    }
+    else
+      free( oyjl_tr_retired_[i].ptr );
+  }
+  if(oyjl_tr_retired_) free(oyjl_tr_retired_);
+  oyjl_tr_retired_ = NULL;
+  oyjl_tr_retired_n_ = 0;
+  oyjlAtomicUnlock_m( oyjl_tr_lock_ );
+}
+
 /** @brief   change language
  *
  *  Call after oyjlTr().
@@ -3271,64 +5658,77 @@ oyjlTr_s ** oyjl_tr_context_ = NULL;
 const char *   oyjlLang              ( const char        * loc )
 {
   const char * lang = NULL;
+  oyjlTr_s ** list;
 
-  if(oyjl_tr_context_)
+  oyjlAtomicAdd_m( oyjl_tr_readers_, 1 );
+  list = oyjlAtomicGet_m( oyjl_tr_context_ );
+
+  if(list)
   {
     int i = 0;
-    while(oyjl_tr_context_[i])
+    oyjlTr_s * context;
+    while((context = oyjlAtomicGet_m( list[i] )) != NULL)
     {
-      oyjlTr_s * context = oyjl_tr_context_[i];
       const char * domain = oyjlTr_GetDomain(context);
       if(*oyjl_debug > 1)
       {
         char * t = oyjlBT(0);
         oyjlMessage_p( oyjlMSG_INFO, 0, "%s", t );
         free(t);
-        oyjlMessage_p( oyjlMSG_INFO, 0, OYJL_DBG_FORMAT "loc: %s context[%d]->loc: %s lang: %s domain: %s", OYJL_DBG_ARGS, loc, i, context->loc, lang, domain );
+        oyjlMessage_p( oyjlMSG_INFO, 0, OYJL_DBG_FORMAT "loc: %s context[%d]->lang: %s lang: %s domain: %s", OYJL_DBG_ARGS, loc, i, oyjlTr_GetLang( context ), lang, domain );
       }
       oyjlTr_SetLocale( context, loc );
-      lang = context->lang?context->lang:context->loc;
+      lang = oyjlTr_GetLang( context );
       if(*oyjl_debug > 1)
-        oyjlMessage_p( oyjlMSG_INFO, 0, OYJL_DBG_FORMAT "loc: %s context[%d]->loc: %s lang: %s", OYJL_DBG_ARGS, loc, i, context->loc, lang );
+        oyjlMessage_p( oyjlMSG_INFO, 0, OYJL_DBG_FORMAT "loc: %s context[%d] lang: %s", OYJL_DBG_ARGS, loc, i, lang );
       ++i;
     }
   }
+  oyjlAtomicAdd_m( oyjl_tr_readers_, -1 );
 
   return lang;
 }
 
 /** @brief   get message translation context
+ *
+ *  The lookup is lock free and can run in parallel to oyjlTr_Set().
  *
  *  @param         domain              select domain of library or application
  *  @return                            context for domain
  *
  *  @version Oyjl: 1.0.0
- *  @date    2021/10/26
+ *  @date    2026/10/19
  *  @since   2021/10/26 (Oyjl: 1.0.0)
  */
 oyjlTr_s *     oyjlTr_Get            ( const char        * domain )
 {
   oyjlTr_s * context = NULL;
+  oyjlTr_s ** list;
 
-  if(oyjl_tr_context_ && domain)
+  oyjlAtomicAdd_m( oyjl_tr_readers_, 1 );
+  list = oyjlAtomicGet_m( oyjl_tr_context_ );
+  if(list && domain)
   {
     int i = 0;
-    while(oyjl_tr_context_[i])
+    while((context = oyjlAtomicGet_m( list[i] )) != NULL)
     {
-      context = oyjl_tr_context_[i];
-      if(context->domain && domain && strcmp(context->domain, domain) == 0)
+      if(context->domain && strcmp(context->domain, domain) == 0)
         break;
-      else
-        context = NULL;
       ++i;
     }
   }
+  oyjlAtomicAdd_m( oyjl_tr_readers_, -1 );
 
   return context;
 }
 
-int         oyjl_tr_context_reserve_ = 0;
 /** @brief   set message translation context
+ *
+ *  Registry changes are published as a whole, so oyjlTr_Get() on other
+ *  threads sees the old or the new context. A replaced or erased context
+ *  is released by a later oyjlTr_Set() call, once no oyjlTr_Get(),
+ *  oyjlLang() or oyjlTranslate() runs. Do not keep a pointer from
+ *  oyjlTr_Get() across a replacement of its domain.
  *
  *  @param         context             message context for oyjlTranslate()
  *                                     - oyjlTr_s context: move in as new current
@@ -3341,13 +5741,14 @@ int         oyjl_tr_context_reserve_ = 0;
  *                                     - 5: context kept
  *
  *  @version Oyjl: 1.0.0
- *  @date    2021/11/01
+ *  @date    2026/10/19
  *  @since   2021/10/26 (Oyjl: 1.0.0)
  */
 int            oyjlTr_Set            ( oyjlTr_s         ** context )
 {
   int i = 0, pos = -1;
   oyjlTr_s * oyjl_tr_context = NULL;
+  oyjlTr_s ** list;
   int state = -1;
   const char * domain;
 
@@ -3363,19 +5764,18 @@ int            oyjlTr_Set            ( oyjlTr_s         ** context )
   }
   state = 0;
 
-  while(oyjl_tr_context_ && oyjl_tr_context_[i])
+  oyjlAtomicLock_m( oyjl_tr_lock_ );
+  list = oyjl_tr_context_;
+  while(list && list[i])
   {
-    oyjlTr_s * context = oyjl_tr_context_[i];
-    if(context->domain && domain && strcmp(context->domain, domain) == 0)
-    {
+    oyjlTr_s * context = list[i];
+    if(pos < 0 && context->domain && domain && strcmp(context->domain, domain) == 0)
       pos = i;
-      break;
-    }
     ++i;
   }
   if(pos >= 0)
   {
-    oyjl_tr_context = oyjl_tr_context_[pos];
+    oyjl_tr_context = list[pos];
     state |= 1;
     if(*oyjl_debug)
     {
@@ -3389,34 +5789,64 @@ int            oyjlTr_Set            ( oyjlTr_s         ** context )
   }
 
   if(context && oyjl_tr_context == *context)
+  {
+    oyjlAtomicUnlock_m( oyjl_tr_lock_ );
     return 1|4;
+  }
 
-  if(context && oyjl_tr_context && oyjl_tr_context != *context)
+  if(context && oyjl_tr_context && *context)
   {
-    oyjlTr_Release(&oyjl_tr_context_[pos]);
+    /* replace in place */
+    oyjlAtomicSet_m( list[pos], *context );
+    oyjlTrRetire_( oyjl_tr_context, 1 );
+    *context = NULL;
     state |= 2;
   }
-
-  if(context && *context)
+  else if(context && oyjl_tr_context)
   {
-    if(!oyjl_tr_context_)
+    /* erase by publishing a copy without pos */
+    oyjlTr_s ** copy = (oyjlTr_s**) calloc( oyjl_tr_context_reserve_, sizeof(oyjlTr_s*) );
+    int j, k = 0;
+    if(!copy)
     {
-      oyjlAllocHelper_m( oyjl_tr_context_, oyjlTr_s*, 10, malloc, return -2 );
-      oyjl_tr_context_reserve_ = 10;
+      oyjlAtomicUnlock_m( oyjl_tr_lock_ );
+      return -2;
     }
-    if(i == oyjl_tr_context_reserve_)
+    for(j = 0; j < i; ++j)
+      if(j != pos)
+        copy[k++] = list[j];
+    oyjlAtomicSet_m( oyjl_tr_context_, copy );
+    oyjlTrRetire_( list, 0 );
+    oyjlTrRetire_( oyjl_tr_context, 1 );
+    state |= 2;
+  }
+  else if(context && *context)
+  {
+    /* keep a terminating NULL behind the new entry */
+    if(!list || i + 1 >= oyjl_tr_context_reserve_)
     {
-      oyjl_tr_context_ = realloc( oyjl_tr_context_, sizeof(oyjlTr_s*) * oyjl_tr_context_reserve_ * 2 );
-      if(!oyjl_tr_context_)
+      int reserve = list ? oyjl_tr_context_reserve_ * 2 : 10;
+      oyjlTr_s ** copy = (oyjlTr_s**) calloc( reserve, sizeof(oyjlTr_s*) );
+      if(!copy)
       {
         oyjlMessage_p( oyjlMSG_ERROR, 0, OYJL_DBG_FORMAT "domain: \"%s\" alloc failed: %d", OYJL_DBG_ARGS, domain, i );
+        oyjlAtomicUnlock_m( oyjl_tr_lock_ );
         return -2;
-      } else
-        oyjl_tr_context_reserve_ *= 2;
+      }
+      if(list)
+        memcpy( copy, list, sizeof(oyjlTr_s*) * i );
+      copy[i] = *context;
+      oyjlAtomicSet_m( oyjl_tr_context_, copy );
+      if(list)
+        oyjlTrRetire_( list, 0 );
+      oyjl_tr_context_reserve_ = reserve;
     }
-    oyjl_tr_context_[i] = *context;
+    else
+      oyjlAtomicSet_m( list[i], *context );
     *context = NULL;
   }
+  oyjlTrRetiredFree_();
+  oyjlAtomicUnlock_m( oyjl_tr_lock_ );
 
   return state;
 }
@@ -35,6 +35,37 @@ extern "C" {
 # endif
 #endif
 
+/* publish pointers to readers on other threads; oyjlAtomicAdd_m() takes long */
+#if defined(__GNUC__) || defined(__clang__)
+# define oyjlAtomicGet_m( ptr )        __atomic_load_n( &(ptr), __ATOMIC_SEQ_CST )
+# define oyjlAtomicSet_m( ptr, value ) __atomic_store_n( &(ptr), value, __ATOMIC_SEQ_CST )
+# define oyjlAtomicAdd_m( var, n )     __atomic_add_fetch( &(var), n, __ATOMIC_SEQ_CST )
+# define oyjlAtomicLock_m( lock )      while(__atomic_test_and_set( &(lock), __ATOMIC_ACQUIRE ))
+# define oyjlAtomicUnlock_m( lock )    __atomic_clear( &(lock), __ATOMIC_RELEASE )
+#elif defined(_MSC_VER)
+# include <intrin.h>
+# define oyjlAtomicGet_m( ptr )        _InterlockedCompareExchangePointer( (void * volatile *)&(ptr), NULL, NULL )
+# define oyjlAtomicSet_m( ptr, value ) _InterlockedExchangePointer( (void * volatile *)&(ptr), (void*)(value) )
+# define oyjlAtomicAdd_m( var, n )     (_InterlockedExchangeAdd( (volatile long *)&(var), n ) + (n))
+# define oyjlAtomicLock_m( lock )      while(_InterlockedExchange8( &(lock), 1 ))
+# define oyjlAtomicUnlock_m( lock )    _InterlockedExchange8( &(lock), 0 )
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_ATOMICS__)
+# include <stdatomic.h>
+# define oyjlAtomicGet_m( ptr )        atomic_load( (void * _Atomic *)&(ptr) )
+# define oyjlAtomicSet_m( ptr, value ) atomic_store( (void * _Atomic *)&(ptr), (void*)(value) )
+# define oyjlAtomicAdd_m( var, n )     (atomic_fetch_add( (_Atomic long *)&(var), n ) + (n))
+# define oyjlAtomicLock_m( lock )      while(atomic_exchange_explicit( (_Atomic char *)&(lock), 1, memory_order_acquire ))
+# define oyjlAtomicUnlock_m( lock )    atomic_store_explicit( (_Atomic char *)&(lock), 0, memory_order_release )
+#else
+# warning "no atomic operations known: use oyjl from one thread only"
+# define OYJL_NO_ATOMICS 1
+# define oyjlAtomicGet_m( ptr )        (ptr)
+# define oyjlAtomicSet_m( ptr, value ) ((ptr) = (value))
+# define oyjlAtomicAdd_m( var, n )     ((var) += (n))
+# define oyjlAtomicLock_m( lock )      ((lock) = 1)
+# define oyjlAtomicUnlock_m( lock )    ((lock) = 0)
+#endif
+
 #define OYJL_LOCALE_VAR "OYJL_LOCALEDIR"
 #define OYJL_DEBUG "OYJL_DEBUG"
 #define OYJL_PRINT_POINTER "0x%tx"
@@ -52,6 +83,13 @@ int oyjlMakeDir_ (const char* path);
 int        oyjlTreePathsGetIndex_    ( const char        * term,
                                        int               * index );
 char *     oyjlTreePrint             ( oyjl_val            v );
+void       oyjlNodesViewsRelease_    ( oyjl_val            nodes );
+void       oyjlTrRegistryRelease_    ( void );
+char *     oyjlStringIntern_         ( const char        * text,
+                                       size_t              len );
+void       oyjlKeyFree_              ( char              * key );
+void       oyjlStringInternRelease_  ( );
+size_t     oyjlStr_Len_              ( oyjl_str            string );
 const char *       oyjlTreeGetString_( oyjl_val            v,
                                        int                 flags OYJL_UNUSED,
                                        const char        * path );
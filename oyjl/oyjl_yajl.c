@@ -24,6 +24,7 @@
 
 #include "oyjl_version.h"
 #include <yajl/yajl_parse.h>
+#include <yajl/yajl_gen.h>
 #ifndef YAJL_VERSION
 #include <yajl/yajl_version.h>
 #endif
@@ -105,6 +106,7 @@ struct context_s
     oyjl_val root;
     char *errbuf;
     size_t errbuf_size;
+    int flags;
 };
 typedef struct context_s context_t;
 
@@ -316,6 +318,32 @@ static int handle_string (void *ctx, const char *string, unsigned int string_len
     return ((context_add_value (ctx, v) == 0) ? STATUS_CONTINUE : STATUS_ABORT);
 }
 
+#if (YAJL_VERSION) > 20000
+static int handle_map_key (void *ctx,
+                           const unsigned char *string, long unsigned int string_length)
+#else
+static int handle_map_key (void *ctx, const char *string, unsigned int string_length)
+#endif
+{
+    oyjl_val v;
+
+    if (!(((context_t *) ctx)->flags & OYJL_INTERN))
+        return handle_string (ctx, string, string_length);
+
+    v = value_alloc (oyjl_t_string);
+    if (v == NULL)
+        RETURN_ERROR ((context_t *) ctx, STATUS_ABORT, "Out of memory");
+
+    v->u.string = oyjlStringIntern_ ((const char *) string, string_length);
+    if (v->u.string == NULL)
+    {
+        free (v);
+        RETURN_ERROR ((context_t *) ctx, STATUS_ABORT, "Out of memory");
+    }
+
+    return ((context_add_value (ctx, v) == 0) ? STATUS_CONTINUE : STATUS_ABORT);
+}
+
 #if (YAJL_VERSION) > 20000
 static int handle_number (void *ctx, const char *string, size_t string_length)
 #else
@@ -447,6 +475,30 @@ static int handle_null (void *ctx)
 
 oyjl_val oyjlTreeParse   (const char *input,
                           char *error_buffer, size_t error_buffer_size)
+{
+  return oyjlTreeParseJson( input, 0, error_buffer, error_buffer_size );
+}
+
+/** @brief   parse JSON with options
+ *
+ *  @param[in]     input               JSON text
+ *  @param[in]     flags               supported:
+ *                                     - ::OYJL_INTERN : share storage of equal
+ *                                       object keys across all interned trees
+ *  @param[out]    error_buffer        place for error message; optional
+ *  @param[in]     error_buffer_size   size of error_buffer
+ *  @return                            tree; release with oyjlTreeFree()
+ *
+ *  @see oyjlTreeParse()
+ *
+ *  @version Oyjl: 1.0.0
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyjl: 1.0.0)
+ */
+oyjl_val   oyjlTreeParseJson         ( const char        * input,
+                                       int                 flags,
+                                       char              * error_buffer,
+                                       size_t              error_buffer_size )
 {
   char * tmp = NULL;
   if(input && strlen(input) > 4 && memcmp(input, "oiJS", 4) == 0)
@@ -461,7 +513,7 @@ static yajl_callbacks oyjl_tree_callbacks_ = {
   handle_number,
   handle_string,
   handle_start_map,
-  handle_string,
+  handle_map_key,
   handle_end_map,
   handle_start_array,
   handle_end_array
@@ -475,7 +527,7 @@ static yajl_callbacks oyjl_tree_callbacks_ = {
   handle_number,
   handle_string,
   handle_start_map,
-  handle_string,
+  handle_map_key,
   handle_end_map,
   handle_start_array,
   handle_end_array
@@ -503,10 +555,11 @@ static yajl_callbacks oyjl_tree_callbacks_ = {
 #endif
     yajl_status status;
     char * internal_err_str;
-	context_t ctx = { NULL, NULL, NULL, 0 };
+	context_t ctx = { NULL, NULL, NULL, 0, 0 };
 
   if(!input) return NULL;
 
+  ctx.flags = flags;
   ctx.errbuf = error_buffer;
 	ctx.errbuf_size = error_buffer_size;
 
@@ -549,7 +602,7 @@ static yajl_callbacks oyjl_tree_callbacks_ = {
         while(ctx.stack)
         {
           if(ctx.stack->key)
-            free(ctx.stack->key);
+            oyjlKeyFree_(ctx.stack->key);
           ctx.stack->key = NULL;
           if(ctx.stack->value)
           {
@@ -571,6 +624,167 @@ static yajl_callbacks oyjl_tree_callbacks_ = {
     if(tmp) free(tmp);
     return (ctx.root);
 }
+
+/* yajl_gen printer state; collects the tokens into chunks for write */
+typedef struct {
+  oyjl_str           text;
+  oyjlWrite_f        write;
+  void             * user_data;
+  int                error;
+} oyjlYajlGen_s;
+#define OYJL_YAJL_GEN_CHUNK 4096
+
+static void oyjlYajlGenPrint_        ( void              * ctx,
+                                       const char        * str,
+#if YAJL_VERSION > 19999
+                                       size_t              len )
+#else
+                                       unsigned int        len )
+#endif
+{
+  oyjlYajlGen_s * gen = (oyjlYajlGen_s*) ctx;
+  if(gen->error)
+    return;
+  oyjlStr_AppendN( gen->text, str, len );
+  if(oyjlStr_Len_( gen->text ) >= OYJL_YAJL_GEN_CHUNK)
+  {
+    gen->error = gen->write( oyjlStr( gen->text ), oyjlStr_Len_( gen->text ), gen->user_data );
+    oyjlStr_Clear( gen->text );
+  }
+}
+
+static int oyjlTreeToYajlGen_        ( oyjl_val            v,
+                                       yajl_gen            g )
+{
+  yajl_gen_status status = yajl_gen_status_ok;
+  int i, count;
+
+  if(!v)
+    return 0;
+
+  switch(v->type)
+  {
+    case oyjl_t_null:
+         status = yajl_gen_null( g );
+         break;
+    case oyjl_t_number:
+         if(v->u.number.r)
+           status = yajl_gen_number( g, v->u.number.r, strlen(v->u.number.r) );
+         else
+           status = yajl_gen_double( g, v->u.number.d );
+         break;
+    case oyjl_t_true:
+    case oyjl_t_false:
+         status = yajl_gen_bool( g, v->type == oyjl_t_true );
+         break;
+    case oyjl_t_string:
+         if(v->u.string)
+           status = yajl_gen_string( g, (const unsigned char*) v->u.string, strlen(v->u.string) );
+         else
+           status = yajl_gen_null( g );
+         break;
+    case oyjl_t_array:
+         count = v->u.array.len;
+         status = yajl_gen_array_open( g );
+         for(i = 0; i < count && status == yajl_gen_status_ok; ++i)
+           if(oyjlTreeToYajlGen_( v->u.array.values[i], g ))
+             return 1;
+         if(status == yajl_gen_status_ok)
+           status = yajl_gen_array_close( g );
+         break;
+    case oyjl_t_object:
+         count = v->u.object.len;
+         status = yajl_gen_map_open( g );
+         for(i = 0; i < count && status == yajl_gen_status_ok; ++i)
+         {
+           if(!v->u.object.keys || !v->u.object.keys[i])
+           {
+             oyjlMessage_p( oyjlMSG_ERROR, 0, OYJL_DBG_FORMAT "missing key", OYJL_DBG_ARGS );
+             return 1;
+           }
+           status = yajl_gen_string( g, (const unsigned char*) v->u.object.keys[i], strlen(v->u.object.keys[i]) );
+           if(status == yajl_gen_status_ok && oyjlTreeToYajlGen_( v->u.object.values[i], g ))
+             return 1;
+         }
+         if(status == yajl_gen_status_ok)
+           status = yajl_gen_map_close( g );
+         break;
+    default:
+         oyjlMessage_p( oyjlMSG_ERROR, 0, OYJL_DBG_FORMAT "unknown type: %d", OYJL_DBG_ARGS, v->type );
+         break;
+  }
+
+  if(status != yajl_gen_status_ok)
+  {
+    oyjlMessage_p( oyjlMSG_ERROR, 0, OYJL_DBG_FORMAT "yajl_gen status: %d", OYJL_DBG_ARGS, status );
+    return 1;
+  }
+  return 0;
+}
+
+/** @brief stream a C tree as JSON through yajl_gen
+ *
+ *  Alternative backend to oyjlTreeWriteJson() using the generator of the
+ *  yajl library. The output is always plain text. Nodes nest up to the
+ *  yajl depth limit.
+ *
+ *  @param         v                   node
+ *  @param         flags               OYJL_JSON_COMPACT for minified output
+ *  @param         write               sink for the text; oyjlWriteToFILE(), oyjlWriteToFd() or custom
+ *  @param         user_data           passed to write
+ *  @return                            0 - success, otherwise the first error from write or 1
+ *
+ *  @version Oyjl: 1.0.0
+ *  @date    2026/10/19
+ *  @since   2026/10/19 (Oyjl: 1.0.0)
+ */
+int        oyjlTreeWriteJsonYajl     ( oyjl_val            v,
+                                       int                 flags,
+                                       oyjlWrite_f         write,
+                                       void              * user_data )
+{
+  oyjlYajlGen_s gen = { NULL, NULL, NULL, 0 };
+  int beautify = !(flags & OYJL_JSON_COMPACT),
+      error;
+  yajl_gen g;
+#if YAJL_VERSION < 20000
+  yajl_gen_config config = { 0, "  " };
+  config.beautify = beautify;
+#endif
+
+  if(!write)
+    return 1;
+
+  gen.write = write;
+  gen.user_data = user_data;
+  gen.text = oyjlStr_New( OYJL_YAJL_GEN_CHUNK, 0,0 );
+
+#if YAJL_VERSION > 19999
+  g = yajl_gen_alloc( NULL );
+  if(g)
+  {
+    yajl_gen_config( g, yajl_gen_beautify, beautify );
+    yajl_gen_config( g, yajl_gen_indent_string, "  " );
+    yajl_gen_config( g, yajl_gen_print_callback, oyjlYajlGenPrint_, &gen );
+  }
+#else
+  g = yajl_gen_alloc2( oyjlYajlGenPrint_, &config, NULL, &gen );
+#endif
+  if(!g)
+  {
+    oyjlStr_Release( &gen.text );
+    return 1;
+  }
+
+  error = oyjlTreeToYajlGen_( v, g );
+  yajl_gen_free( g );
+
+  if(!error && !gen.error && oyjlStr_Len_( gen.text ))
+    gen.error = write( oyjlStr( gen.text ), oyjlStr_Len_( gen.text ), user_data );
+  oyjlStr_Release( &gen.text );
+
+  return gen.error ? gen.error : error;
+}
 #undef Florian_Forster_SOURCE_GUARD
 
 /** @brief obtain a new node object possibly in array
@@ -632,6 +846,7 @@ oyjl_val oyjlTreeGetNewValueFromArray( oyjl_val            root,
 
 #if defined(OYJL_HAVE_LIBXML2) || defined(DOXYGEN)
 #include <libxml/parser.h>
+#include <libxml/parserInternals.h>
 #include <libxml/xmlmemory.h>
 #include <libxml/xpath.h>
 #include <libxml/xpathInternals.h>
@@ -639,153 +854,241 @@ oyjl_val oyjlTreeGetNewValueFromArray( oyjl_val            root,
 #include "oyjl.h"
 
 
-char *             oyjlXML2NodeName  ( xmlNodePtr          cur )
+/* one open XML element */
+typedef struct {
+  oyjl_val           node;             /* the element value */
+  int                children;         /* child nodes seen so far */
+  int                text_type;        /* XML_TEXT_NODE or XML_CDATA_SECTION_NODE, when the last child is a text run */
+} oyjlXmlSaxFrame_s;
+
+/* SAX2 parse state; found in xmlParserCtxt::_private */
+typedef struct {
+  oyjl_val           root;
+  oyjlXmlSaxFrame_s* stack;            /* open elements */
+  int                level;
+  int                stack_size;
+  oyjl_str           text;             /* text run of a possibly single child */
+  int                flags;            /* OYJL_NUMBER_DETECTION */
+  int                error;
+} oyjlXmlSax_s;
+
+static oyjlXmlSax_s * oyjlXmlSaxGet_ ( void              * ctx )
 {
-  char * name = NULL;
-  const xmlChar * prefix = cur->ns && cur->ns->prefix ? cur->ns->prefix : 0;
-  if(prefix)
-  {
-    oyjlStringAdd( &name, 0,0, (char*)prefix );
-    oyjlStringAdd( &name, 0,0, ":" );
-  }
-  oyjlStringAdd( &name, 0,0, (char*)cur->name );
-  return name;
+  xmlParserCtxtPtr ctxt = (xmlParserCtxtPtr) ctx;
+  oyjlXmlSax_s * sax = (oyjlXmlSax_s*) ctxt->_private;
+  if(sax->error)
+    return NULL;
+  return sax;
 }
 
-int              oyjlXMLNodeIsText   ( xmlNodePtr          cur )
+static void oyjlXmlSaxFail_          ( void              * ctx,
+                                       oyjlXmlSax_s      * sax )
 {
-  return cur->type == XML_TEXT_NODE && !(cur->next || cur->prev) &&
-         cur->content ;
+  sax->error = 1;
+  xmlStopParser( (xmlParserCtxtPtr) ctx );
 }
 
-int              oyjlXMLNodeIsCData  ( xmlNodePtr          cur )
+/* a non text child closes the pending text run */
+static void oyjlXmlSaxChild_         ( oyjlXmlSax_s      * sax )
 {
-  return cur->type == XML_CDATA_SECTION_NODE && !(cur->next || cur->prev) &&
-         cur->content ;
+  if(sax->level)
+  {
+    oyjlXmlSaxFrame_s * frame = &sax->stack[sax->level - 1];
+    ++frame->children;
+    frame->text_type = 0;
+  }
 }
 
-void             oyjlParseXMLDoc_    ( xmlDocPtr           doc,
-                                       xmlNodePtr          cur,
-                                       int                 flags,
-                                       oyjl_val            root )
+static void oyjlXmlSaxStart_         ( void              * ctx,
+                                       const xmlChar     * localname,
+                                       const xmlChar     * prefix,
+                                       const xmlChar     * URI OYJL_UNUSED,
+                                       int                 nb_namespaces,
+                                       const xmlChar    ** namespaces,
+                                       int                 nb_attributes,
+                                       int                 nb_defaulted OYJL_UNUSED,
+                                       const xmlChar    ** attributes )
 {
-  while(cur != NULL)
-  {
-    char * name = 0;
-    oyjl_val node = NULL;
+  oyjlXmlSax_s * sax = oyjlXmlSaxGet_( ctx );
+  oyjl_val parent, node;
+  char * name = NULL;
+  int i;
 
-    if(cur->type == XML_ELEMENT_NODE)
-    {
-      oyjl_val array = NULL;
-      int count = -1;
-      name = oyjlXML2NodeName( cur );
-      node = oyjlTreeGetNewValueFromArray( root, name, &array, &count );
+  if(!sax) return;
 
-      if(cur->nsDef)
-      {
-        xmlNsPtr xcur = cur->nsDef; 
-        while(xcur != NULL)
-        {
-          const char * prefix = (const char *) xcur->prefix;
-          const char * val = (const char *) xcur->href;
-          char * attr = NULL;
-          oyjl_val prop;
-          oyjlStringAdd( &attr, 0,0, "xmlns:%s", prefix );
-          if(!attr) return;
-          if(array)
-            prop = oyjlTreeGetValueF( root, OYJL_CREATE_NEW, "%s/[%d]/@%s", name, count, attr );
-          else
-            prop = oyjlTreeGetValueF( root, OYJL_CREATE_NEW, "%s/@%s", name, attr );
-          oyjlValueSetString( prop, val );
-          free( attr );
-          xcur = xcur->next;
-        }
-      }
+  parent = sax->level ? sax->stack[sax->level - 1].node : sax->root;
+  oyjlXmlSaxChild_( sax );
 
-      if(cur->properties)
-      {
-        xmlAttrPtr xcur = cur->properties; 
-        while(xcur != NULL)
-        {
-          const char * attr = (const char *) xcur->name;
-          const char * val = (const char *) xcur->children->content;
-          oyjl_val prop;
-          if(array)
-            prop = oyjlTreeGetValueF( root, OYJL_CREATE_NEW, "%s/[%d]/@%s", name, count, attr );
-          else
-            prop = oyjlTreeGetValueF( root, OYJL_CREATE_NEW, "%s/@%s", name, attr );
-          oyjlValueSetString( prop, val );
-          xcur = xcur->next;
-        }
-      }
-    }
+  if(prefix)
+    oyjlStringAdd( &name, 0,0, "%s:%s", (const char*)prefix, (const char*)localname );
+  else
+    name = oyjlStringCopy( (const char*)localname, 0 );
+  node = name ? oyjlTreeGetNewValueFromArray( parent, name, NULL, NULL ) : NULL;
+  free( name );
+  if(!node) { oyjlXmlSaxFail_( ctx, sax ); return; }
+
+  for(i = 0; i < nb_namespaces; ++i)
+  {
+    const char * ns_prefix = (const char*) namespaces[2*i],
+               * href = (const char*) namespaces[2*i + 1];
+    oyjl_val prop;
+    if(ns_prefix)
+      prop = oyjlTreeGetValueF( node, OYJL_CREATE_NEW, "@xmlns:%s", ns_prefix );
     else
-    if( oyjlXMLNodeIsText(cur) )
+      prop = oyjlTreeGetValue( node, OYJL_CREATE_NEW, "@xmlns" );
+    oyjlValueSetString( prop, href );
+  }
+
+  for(i = 0; i < nb_attributes; ++i)
+  {
+    const char * attr = (const char*) attributes[5*i],
+               * start = (const char*) attributes[5*i + 3],
+               * end = (const char*) attributes[5*i + 4];
+    oyjl_val prop = oyjlTreeGetValueF( node, OYJL_CREATE_NEW, "@%s", attr );
+    /* SAX2 keeps references in attribute values; "&amp;" arrives as "&#38;" */
+    if(memchr( start, '&', end - start ))
     {
-      const char * val = (const char *) cur->content;
-      double d;
-      int err = -1;
+      xmlChar * value = xmlStringLenDecodeEntities( (xmlParserCtxtPtr) ctx, (const xmlChar*) start, end - start, XML_SUBSTITUTE_REF, 0,0,0 );
+      if(!value) { oyjlXmlSaxFail_( ctx, sax ); return; }
+      oyjlValueSetString( prop, (const char*) value );
+      xmlFree( value );
+      continue;
+    }
+    oyjlStr_Clear( sax->text );
+    oyjlStr_AppendN( sax->text, start, end - start );
+    oyjlValueSetString( prop, oyjlStr( sax->text ) );
+  }
+  oyjlStr_Clear( sax->text );
 
-      if(flags & OYJL_NUMBER_DETECTION)
-        err = oyjlStringToDouble( val, &d, 0 );
-      if(err == 0)
-      {
-        root->type = oyjl_t_number;
-        root->u.number.r = strdup(val);
-        root->u.number.d = d;
-        root->u.number.flags |= OYJL_NUMBER_DOUBLE_VALID;
-        errno = 0;
-        root->u.number.i = strtol(root->u.number.r, 0, 10);
-        if (errno == 0)
-          root->u.number.flags |= OYJL_NUMBER_INT_VALID;
-      } else if(flags & OYJL_NUMBER_DETECTION)
-      {
-        if(strcmp(val,"true") == 0)
-        {
-          err = 0;
-          root->type = oyjl_t_true;
-        } else if(strcmp(val,"false") == 0)
-        {
-          err = 0;
-          root->type = oyjl_t_false;
-        }
-      }
+  if(sax->level >= sax->stack_size)
+  {
+    int size = sax->stack_size ? sax->stack_size * 2 : 32;
+    oyjlXmlSaxFrame_s * stack = realloc( sax->stack, size * sizeof(*stack) );
+    if(!stack) { oyjlXmlSaxFail_( ctx, sax ); return; }
+    sax->stack = stack;
+    sax->stack_size = size;
+  }
+  sax->stack[sax->level].node = node;
+  sax->stack[sax->level].children = 0;
+  sax->stack[sax->level].text_type = 0;
+  ++sax->level;
+}
 
-      if(err != 0)
-        oyjlValueSetString( root, val );
+/* place a single inner text as string or detected number */
+static void oyjlXmlSaxSetText_       ( oyjl_val            root,
+                                       const char        * val,
+                                       int                 flags )
+{
+  double d;
+  int err = -1;
 
-    } else
-    if( oyjlXMLNodeIsCData(cur) )
+  if(flags & OYJL_NUMBER_DETECTION)
+    err = oyjlStringToDouble( val, &d, 0 );
+  if(err == 0)
+  {
+    root->type = oyjl_t_number;
+    root->u.number.r = strdup(val);
+    root->u.number.d = d;
+    root->u.number.flags |= OYJL_NUMBER_DOUBLE_VALID;
+    errno = 0;
+    root->u.number.i = strtol(root->u.number.r, 0, 10);
+    if (errno == 0)
+      root->u.number.flags |= OYJL_NUMBER_INT_VALID;
+  } else if(flags & OYJL_NUMBER_DETECTION)
+  {
+    if(strcmp(val,"true") == 0)
     {
-      const char * val = (const char *) cur->content;
-      oyjlValueSetString( root, val );
-    }
-
-    if(cur->xmlChildrenNode)
+      err = 0;
+      root->type = oyjl_t_true;
+    } else if(strcmp(val,"false") == 0)
     {
-      oyjl_val text = NULL;
-      xmlNodePtr cur_ = cur->xmlChildrenNode;
-
-      if( oyjlXMLNodeIsText(cur_) && node && node->type == oyjl_t_object )
-        text = oyjlTreeGetValue( node, OYJL_CREATE_NEW, "@text" );
-      else
-      if( oyjlXMLNodeIsCData(cur_) && node && (node->type == oyjl_t_object ||
-                                               node->type == oyjl_t_null) )
-        text = oyjlTreeGetValue( node, OYJL_CREATE_NEW, "@cdata" );
-      /*else
-      if( cur->children && cur->children->type == XML_CDATA_SECTION_NODE && !(cur->children->next || cur->children->prev) &&
-         cur->children->content )
-        text = oyjlTreeGetValue( node, OYJL_CREATE_NEW, "@cdata" );*/
-
-      oyjlParseXMLDoc_( doc, cur->xmlChildrenNode, flags,
-                        text ? text : node );
+      err = 0;
+      root->type = oyjl_t_false;
     }
+  }
 
-    if(name)
-      free( name );
+  if(err != 0)
+    oyjlValueSetString( root, val );
+}
 
-    cur = cur->next;
+static void oyjlXmlSaxEnd_           ( void              * ctx,
+                                       const xmlChar     * localname OYJL_UNUSED,
+                                       const xmlChar     * prefix OYJL_UNUSED,
+                                       const xmlChar     * URI OYJL_UNUSED )
+{
+  oyjlXmlSax_s * sax = oyjlXmlSaxGet_( ctx );
+  oyjlXmlSaxFrame_s * frame;
+  oyjl_val node;
+
+  if(!sax || !sax->level) return;
+
+  frame = &sax->stack[--sax->level];
+  node = frame->node;
+  /* only a single text child becomes the value or "@text" / "@cdata" */
+  if(frame->children == 1 && frame->text_type == XML_TEXT_NODE)
+  {
+    if(node->type == oyjl_t_object)
+      node = oyjlTreeGetValue( node, OYJL_CREATE_NEW, "@text" );
+    oyjlXmlSaxSetText_( node, oyjlStr( sax->text ), sax->flags );
   }
+  else if(frame->children == 1 && frame->text_type == XML_CDATA_SECTION_NODE)
+  {
+    if(node->type == oyjl_t_object || node->type == oyjl_t_null)
+      node = oyjlTreeGetValue( node, OYJL_CREATE_NEW, "@cdata" );
+    oyjlValueSetString( node, oyjlStr( sax->text ) );
+  }
+  oyjlStr_Clear( sax->text );
+}
+
+static void oyjlXmlSaxTextRun_       ( void              * ctx,
+                                       const xmlChar     * ch,
+                                       int                 len,
+                                       int                 type )
+{
+  oyjlXmlSax_s * sax = oyjlXmlSaxGet_( ctx );
+  oyjlXmlSaxFrame_s * frame;
+
+  if(!sax || !sax->level) return;
+
+  frame = &sax->stack[sax->level - 1];
+  if(frame->text_type != type)
+  {
+    ++frame->children;
+    frame->text_type = type;
+    oyjlStr_Clear( sax->text );
+  }
+  /* keep only text, which can end up as value */
+  if(frame->children == 1)
+    oyjlStr_AppendN( sax->text, (const char*)ch, len );
+}
+
+static void oyjlXmlSaxText_          ( void              * ctx,
+                                       const xmlChar     * ch,
+                                       int                 len )
+{
+  oyjlXmlSaxTextRun_( ctx, ch, len, XML_TEXT_NODE );
+}
+
+static void oyjlXmlSaxCData_         ( void              * ctx,
+                                       const xmlChar     * ch,
+                                       int                 len )
+{
+  oyjlXmlSaxTextRun_( ctx, ch, len, XML_CDATA_SECTION_NODE );
+}
+
+static void oyjlXmlSaxComment_       ( void              * ctx,
+                                       const xmlChar     * value OYJL_UNUSED )
+{
+  oyjlXmlSax_s * sax = oyjlXmlSaxGet_( ctx );
+  if(sax) oyjlXmlSaxChild_( sax );
+}
+
+static void oyjlXmlSaxPI_            ( void              * ctx,
+                                       const xmlChar     * target OYJL_UNUSED,
+                                       const xmlChar     * data OYJL_UNUSED )
+{
+  oyjlXmlSax_s * sax = oyjlXmlSaxGet_( ctx );
+  if(sax) oyjlXmlSaxChild_( sax );
 }
 
 /** \addtogroup oyjl_tree
@@ -796,6 +1099,9 @@ void             oyjlParseXMLDoc_    ( xmlDocPtr           doc,
  *  as objects with key '\@text'. Repeating XML nodes are placed into a array
  *  below a object with the key name of the nodes.
  *
+ *  The nodes are created from libxml2 SAX2 events, without an
+ *  intermediate xmlDoc.
+ *
  *  This function needs linking to libOyjl.
  *
  *  @see oyjlTreeToXml()
@@ -814,8 +1120,9 @@ oyjl_val   oyjlTreeParseXml          ( const char        * xml,
                                        char              * error_buffer,
                                        size_t              error_buffer_size)
 {
-  xmlDocPtr doc = NULL;
-  xmlNodePtr cur = NULL;
+  xmlSAXHandler handler;
+  xmlParserCtxtPtr ctxt;
+  oyjlXmlSax_s sax = { NULL, NULL, 0, 0, NULL, 0, 0 };
   oyjl_val jroot =  NULL;
   char * tmp = NULL;
 
@@ -827,23 +1134,52 @@ oyjl_val   oyjlTreeParseXml          ( const char        * xml,
     xml = tmp = oyjlStringCopy( t, 0 );
   }
 
-  doc = xmlParseMemory( xml, strlen(xml) );
-  cur = xmlDocGetRootElement(doc);
-
-  if(doc && cur)
+  memset( &handler, 0, sizeof(handler) );
+  xmlSAXVersion( &handler, 2 );
+  handler.startElementNs = oyjlXmlSaxStart_;
+  handler.endElementNs = oyjlXmlSaxEnd_;
+  handler.characters = oyjlXmlSaxText_;
+  handler.ignorableWhitespace = oyjlXmlSaxText_;
+  handler.cdataBlock = oyjlXmlSaxCData_;
+  handler.comment = oyjlXmlSaxComment_;
+  handler.processingInstruction = oyjlXmlSaxPI_;
+  handler.reference = oyjlXmlSaxComment_;
+
+  sax.root = oyjlTreeNew( NULL );
+  sax.text = oyjlStr_New( 10, 0,0 );
+  sax.flags = flags;
+
+  ctxt = xmlCreateMemoryParserCtxt( xml, strlen(xml) );
+  if(ctxt && sax.root && sax.text)
   {
-    jroot = oyjlTreeNew( NULL );
-    oyjlParseXMLDoc_( doc, cur, flags, jroot );
+    if(ctxt->sax)
+      xmlFree( ctxt->sax );
+    ctxt->sax = &handler;
+    ctxt->_private = &sax;
+    xmlParseDocument( ctxt );
+    /* the document node holds only DTD declarations */
+    if(ctxt->myDoc)
+      xmlFreeDoc( ctxt->myDoc );
+    ctxt->myDoc = NULL;
+    ctxt->sax = NULL;
+    if(ctxt->wellFormed && !sax.error && sax.root->type == oyjl_t_object)
+    {
+      jroot = sax.root;
+      sax.root = NULL;
+    }
   }
-  else if(error_buffer)
+  if(ctxt)
+    xmlFreeParserCtxt( ctxt );
+  if(!jroot && error_buffer)
     snprintf( error_buffer, error_buffer_size, "XML loading failed" );
 
   if(error_buffer && error_buffer[0])
     oyjlMessage_p( oyjlMSG_ERROR, 0, OYJL_DBG_FORMAT "%s",
                          OYJL_DBG_ARGS, error_buffer );
 
-  if(doc)
-    xmlFreeDoc( doc );
+  oyjlTreeFree( sax.root );
+  oyjlStr_Release( &sax.text );
+  free( sax.stack );
   if(tmp) free(tmp);
 
   return jroot;
@@ -853,99 +1189,250 @@ oyjl_val   oyjlTreeParseXml          ( const char        * xml,
 
 #if defined(OYJL_HAVE_YAML) || defined(DOXYGEN)
 #include <yaml.h>
-int oyjlYamlGetCount( yaml_node_t * n )
+/* anchor for a YAML alias; scalars are kept detached, containers point into the tree */
+typedef struct {
+  char             * name;
+  oyjl_val           node;
+  int                owned;
+} oyjlYamlAnchor_s;
+
+typedef struct {
+  context_t          ctx;
+  oyjlYamlAnchor_s * anchors;
+  int                anchors_n;
+  int                flags;
+} oyjlYamlParse_s;
+
+/* is the next scalar a object key */
+static int  oyjlYamlIsKey_           ( context_t         * ctx )
 {
-  int i = 0;
-  if( !n ) return i;
-  switch( n->type )
+  return ctx->stack && OYJL_IS_OBJECT(ctx->stack->value) && ctx->stack->key == NULL;
+}
+
+/* replay a finished node into the context, for aliases */
+static int  oyjlYamlReplay_          ( context_t         * ctx,
+                                       oyjl_val            v )
+{
+  size_t i;
+  int status = STATUS_CONTINUE;
+  const char * t;
+
+  if(oyjlYamlIsKey_( ctx ))
+  {
+    t = OYJL_IS_STRING(v) ? v->u.string : OYJL_IS_NUMBER(v) ? v->u.number.r : NULL;
+    if(!t)
+      RETURN_ERROR( ctx, STATUS_ABORT, "Object key is not a string" );
+    return handle_map_key( ctx, (const void*) t, strlen(t) );
+  }
+
+  switch(v->type)
   {
-    case YAML_SCALAR_NODE: i = n->data.scalar.length; break;
-    case YAML_SEQUENCE_NODE: i = n->data.sequence.items.top - n->data.sequence.items.start; break;
-    case YAML_MAPPING_NODE: i = n->data.mapping.pairs.top - n->data.mapping.pairs.start; break;
-    default: break;
+    case oyjl_t_string:
+         t = v->u.string ? v->u.string : "";
+         return handle_string( ctx, (const void*) t, strlen(t) );
+    case oyjl_t_number:
+         return handle_number( ctx, v->u.number.r, strlen(v->u.number.r) );
+    case oyjl_t_true:
+    case oyjl_t_false:
+         return handle_boolean( ctx, v->type == oyjl_t_true );
+    case oyjl_t_array:
+         status = handle_start_array( ctx );
+         for(i = 0; i < v->u.array.len && status == STATUS_CONTINUE; ++i)
+           status = oyjlYamlReplay_( ctx, v->u.array.values[i] );
+         return status == STATUS_CONTINUE ? handle_end_array( ctx ) : status;
+    case oyjl_t_object:
+         status = handle_start_map( ctx );
+         for(i = 0; i < v->u.object.len && status == STATUS_CONTINUE; ++i)
+         {
+           t = v->u.object.keys[i];
+           status = handle_map_key( ctx, (const void*) t, strlen(t) );
+           if(status == STATUS_CONTINUE)
+             status = oyjlYamlReplay_( ctx, v->u.object.values[i] );
+         }
+         return status == STATUS_CONTINUE ? handle_end_map( ctx ) : status;
+    default:
+         return handle_null( ctx );
   }
-  return i;
 }
 
-int oyjlYamlGetId( yaml_node_t * n, int index, int key )
+static int  oyjlYamlAnchor_          ( oyjlYamlParse_s   * p,
+                                       const yaml_char_t * anchor,
+                                       oyjl_val            node,
+                                       int                 owned )
 {
-  int id = 0;
-  if( !n ) return id;
-  if( n->type == YAML_SEQUENCE_NODE )
-    id = n->data.sequence.items.start[index];
+  oyjlYamlAnchor_s * anchors;
 
-  if( n->type == YAML_MAPPING_NODE )
+  if(!anchor)
   {
-    if(key == 1)
-      id = n->data.mapping.pairs.start[index].key;
-    else
-      id = n->data.mapping.pairs.start[index].value;
+    if(owned) oyjlTreeFree( node );
+    return 0;
   }
 
-  return id;
+  anchors = realloc( p->anchors, (p->anchors_n + 1) * sizeof(*anchors) );
+  if(!anchors)
+  {
+    if(owned) oyjlTreeFree( node );
+    RETURN_ERROR( &p->ctx, ENOMEM, "Out of memory" );
+  }
+  p->anchors = anchors;
+  anchors[p->anchors_n].name = strdup( (const char*) anchor );
+  anchors[p->anchors_n].node = node;
+  anchors[p->anchors_n].owned = owned;
+  ++p->anchors_n;
+
+  return 0;
 }
 
-static int oyjlYamlReadNode_( yaml_document_t * doc, yaml_node_t * node, int flags, int is_key, char ** json )
+static int  oyjlYamlAlias_           ( oyjlYamlParse_s   * p,
+                                       const yaml_char_t * anchor )
 {
-  int error = 0;
-  int count, i;
-  if( !node ) return 1;
-  count = oyjlYamlGetCount( node );
-  if( node->type == YAML_SCALAR_NODE )
+  stack_elem_t * open;
+  int i;
+
+  /* the most recent definition wins */
+  for(i = p->anchors_n - 1; i >= 0; --i)
+    if(strcmp( p->anchors[i].name, (const char*) anchor ) == 0)
+      break;
+  if(i < 0)
+    RETURN_ERROR( &p->ctx, STATUS_ABORT, "found undefined alias" );
+
+  /* a alias into a still open node would recurse */
+  for(open = p->ctx.stack; open; open = open->next)
+    if(open->value == p->anchors[i].node)
+      RETURN_ERROR( &p->ctx, STATUS_ABORT, "found recursive alias" );
+
+  return oyjlYamlReplay_( &p->ctx, p->anchors[i].node );
+}
+
+/* oyjlTreeToYaml() escapes in plain scalars only '"' and ": " */
+static int  oyjlYamlScalar_          ( oyjlYamlParse_s   * p,
+                                       yaml_event_t      * event )
+{
+  context_t * ctx = &p->ctx;
+  char * t = (char*) event->data.scalar.value;
+  size_t len = event->data.scalar.length, i, n = 0;
+  int is_key = oyjlYamlIsKey_( ctx ),
+      plain = event->data.scalar.style == YAML_PLAIN_SCALAR_STYLE,
+      number = 0,
+      status;
+  char * tmp = NULL;
+  double d;
+
+  if(plain && memchr( t, '\\', len ))
   {
-    char * t = (char*)node->data.scalar.value,
-         * tmp = oyjlStringCopy(t,malloc);
-    oyjlStringReplace( &tmp, ":\\ ", ": ", 0, 0);
-    if(tmp)
+    tmp = malloc( len + 1 );
+    if(!tmp)
+      RETURN_ERROR( ctx, STATUS_ABORT, "Out of memory" );
+    for(i = 0; i < len; ++i)
     {
-      double d;
-      int err = -1;
-      if(flags & OYJL_NUMBER_DETECTION && is_key != 1)
-        err = oyjlStringToDouble( tmp, &d, 0 );
-      if(err == 0)
-        oyjlStringAdd( json, 0,0, "%s", tmp );
-      else
-        oyjlStringAdd( json, 0,0, "\"%s\"", tmp );
+      if(t[i] == '\\' && i + 1 < len && t[i+1] == '"')
+        ++i;
+      else if(t[i] == ':' && i + 2 < len && t[i+1] == '\\' && t[i+2] == ' ')
+      {
+        tmp[n++] = ':';
+        i += 1;
+        continue;
+      }
+      tmp[n++] = t[i];
     }
-    if(tmp) free(tmp);
+    tmp[n] = '\000';
+    t = tmp;
+    len = n;
   }
-  if( node->type == YAML_SEQUENCE_NODE )
+
+  /* a root scalar is kept as string */
+  if(!is_key && plain && ctx->stack && p->flags & OYJL_NUMBER_DETECTION)
+    number = oyjlStringToDouble( t, &d, 0 ) == 0;
+
+  if(is_key)
+    status = handle_map_key( ctx, (const void*) t, len );
+  else if(number)
+    status = handle_number( ctx, t, len );
+  else
+    status = handle_string( ctx, (const void*) t, len );
+
+  if(status == STATUS_CONTINUE && event->data.scalar.anchor)
   {
-    oyjlStringAdd( json, 0,0, "[");
-    for(i = 0; i < count && !error; ++i)
+    /* keep a detached copy, as the tree node may become a key */
+    context_t detached = *ctx;
+    detached.stack = NULL;
+    detached.root = NULL;
+    if(number)
+      status = handle_number( &detached, t, len );
+    else
+      status = handle_string( &detached, (const void*) t, len );
+    if(status == STATUS_CONTINUE &&
+       oyjlYamlAnchor_( p, event->data.scalar.anchor, detached.root, 1 ))
+      status = STATUS_ABORT;
+  }
+
+  if(tmp) free(tmp);
+  return status;
+}
+
+/* build the tree directly from libyaml events */
+static int  oyjlYamlParseEvents_     ( yaml_parser_t     * parser,
+                                       oyjlYamlParse_s   * p )
+{
+  context_t * ctx = &p->ctx;
+  yaml_event_t event;
+  int done = 0, status = STATUS_CONTINUE;
+
+  while(!done && status == STATUS_CONTINUE)
+  {
+    if(!yaml_parser_parse( parser, &event ))
+      return 1;
+
+    switch(event.type)
     {
-      int id = oyjlYamlGetId( node, i, 0 );
-      yaml_node_t * n =
-      yaml_document_get_node( doc, id );
-      error = oyjlYamlReadNode_(doc, n, flags, 0, json);
-      if(i < count - 1) oyjlStringAdd( json, 0,0, ",");
+      case YAML_SCALAR_EVENT:
+           status = oyjlYamlScalar_( p, &event );
+           break;
+      case YAML_ALIAS_EVENT:
+           status = oyjlYamlAlias_( p, event.data.alias.anchor );
+           break;
+      case YAML_SEQUENCE_START_EVENT:
+      case YAML_MAPPING_START_EVENT:
+           if(oyjlYamlIsKey_( ctx ))
+           {
+             if(ctx->errbuf)
+               snprintf( ctx->errbuf, ctx->errbuf_size, "Object key is not a string" );
+             status = STATUS_ABORT;
+             break;
+           }
+           if(event.type == YAML_SEQUENCE_START_EVENT)
+             status = handle_start_array( ctx );
+           else
+             status = handle_start_map( ctx );
+           if(status == STATUS_CONTINUE &&
+              oyjlYamlAnchor_( p, event.type == YAML_SEQUENCE_START_EVENT ?
+                                  event.data.sequence_start.anchor :
+                                  event.data.mapping_start.anchor,
+                               ctx->stack->value, 0 ))
+             status = STATUS_ABORT;
+           break;
+      case YAML_SEQUENCE_END_EVENT:
+           status = handle_end_array( ctx );
+           break;
+      case YAML_MAPPING_END_EVENT:
+           status = handle_end_map( ctx );
+           break;
+      /* only the first document is read */
+      case YAML_DOCUMENT_END_EVENT:
+      case YAML_STREAM_END_EVENT:
+           done = 1;
+           break;
+      default:
+           break;
     }
-    oyjlStringAdd( json, 0,0, "]");
+
+    yaml_event_delete( &event );
   }
-  if( node->type == YAML_MAPPING_NODE )
-    for(i = 0; i < count; ++i)
-    {
-      int key_id = oyjlYamlGetId( node, i, 1 );
-      int val_id = oyjlYamlGetId( node, i, 0 );
-      yaml_node_t * key =
-      yaml_document_get_node( doc, key_id );
-      yaml_node_t * val =
-      yaml_document_get_node( doc, val_id );
-
-      if(i == 0) oyjlStringAdd( json, 0,0, "{");
-
-      error = oyjlYamlReadNode_(doc, key, flags, 1, json);
-      if( key->type == YAML_SCALAR_NODE &&
-          !error )
-      {
-        oyjlStringAdd( json, 0,0, ":");
-      }
 
-      error = oyjlYamlReadNode_(doc, val, flags, 0, json);
-      if(i < count - 1) oyjlStringAdd( json, 0,0, ",");
-      else if( i == count - 1 ) oyjlStringAdd( json, 0,0, "}");
-    }
-  return error;
+  if(status != STATUS_CONTINUE || !ctx->root)
+    return 2;
+
+  return 0;
 }
 
 /** \addtogroup oyjl_tree
@@ -954,12 +1441,15 @@ static int oyjlYamlReadNode_( yaml_document_t * doc, yaml_node_t * node, int fla
  *
  *  This function needs linking to libOyjl.
  *
+ *  The tree is build from libyaml events without a intermediate document.
+ *
  *  @see oyjlTreeToYaml()
  *
  *  @param[in]     yaml                the YAML text
  *  @param[in]     flags               for processing
  *                                     - ::OYJL_NUMBER_DETECTION for parsing
  *                                       of values as possibly numbers
+ *                                     - ::OYJL_INTERN share object key storage
  *  @param[out]    error_buffer        place a error message
  *  @param[out]    error_buffer_size   size of error_buffer
  *  @return                            object tree on success,
@@ -971,14 +1461,11 @@ oyjl_val   oyjlTreeParseYaml         ( const char        * yaml,
                                        size_t              error_buffer_size)
 {
   yaml_parser_t parser;
-  yaml_document_t document;
-  yaml_node_t * root = NULL;
-  char * json = NULL;
+  oyjlYamlParse_s p;
   char * tmp = NULL;
-  oyjl_val jroot = NULL;
-  int error = 0;
+  int error = 0, i;
 
-  if(!yaml) return jroot;
+  if(!yaml) return NULL;
 
   if(!yaml_parser_initialize(&parser))
   {
@@ -986,7 +1473,7 @@ oyjl_val   oyjlTreeParseYaml         ( const char        * yaml,
       snprintf( error_buffer, error_buffer_size, "YAML initialisation failed" );
     oyjlMessage_p( oyjlMSG_ERROR, 0, OYJL_DBG_FORMAT "%s", OYJL_DBG_ARGS,
                    "YAML initialisation failed" );
-    return jroot;
+    return NULL;
   }
 
   if(strstr(yaml, "\033[0") != NULL)
@@ -995,37 +1482,63 @@ oyjl_val   oyjlTreeParseYaml         ( const char        * yaml,
     yaml = tmp = oyjlStringCopy( t, 0 );
   }
 
+  memset( &p, 0, sizeof(p) );
+  p.ctx.flags = flags & OYJL_INTERN;
+  p.ctx.errbuf = error_buffer;
+  p.ctx.errbuf_size = error_buffer_size;
+  p.flags = flags;
+  if(error_buffer && error_buffer_size)
+    memset( error_buffer, 0, error_buffer_size );
+
   yaml_parser_set_input_string( &parser, (const unsigned char*) yaml, strlen(yaml));
 
-  yaml_parser_load( &parser, &document );
-  if( parser.error != YAML_NO_ERROR)
+  error = oyjlYamlParseEvents_( &parser, &p );
+  if( error == 1 )
   {
     if(error_buffer)
       snprintf( error_buffer, error_buffer_size, "%s\n", parser.problem ? parser.problem : "" );
     oyjlMessage_p( oyjlMSG_ERROR, 0, OYJL_DBG_FORMAT "%s", OYJL_DBG_ARGS,
                    parser.problem ? parser.problem : "" );
-
-    return jroot;
   }
-
-  root = yaml_document_get_root_node(&document);
-  error = oyjlYamlReadNode_( &document, root, flags, 1, &json );
-  if( error )
+  else if( error )
   {
-    if(error_buffer)
+    if(error_buffer && !error_buffer[0])
       snprintf( error_buffer, error_buffer_size, "Found problem while parsing document tree.\n" );
     oyjlMessage_p( oyjlMSG_ERROR, 0, OYJL_DBG_FORMAT "%s", OYJL_DBG_ARGS,
-                   "Found problem while parsing document tree." );
-    return jroot;
+                   error_buffer ? error_buffer : "Found problem while parsing document tree." );
+  }
+
+  if( error )
+  {
+    while(p.ctx.stack)
+    {
+      if(p.ctx.stack->key)
+        oyjlKeyFree_(p.ctx.stack->key);
+      p.ctx.stack->key = NULL;
+      if(p.ctx.stack->value)
+      {
+        oyjlValueClear(p.ctx.stack->value);
+        free(p.ctx.stack->value);
+        p.ctx.stack->value = NULL;
+      }
+      context_pop(&p.ctx);
+    }
+    oyjlTreeFree( p.ctx.root );
+    p.ctx.root = NULL;
   }
 
-  jroot = oyjlTreeParse( json, error_buffer, error_buffer_size );
+  for(i = 0; i < p.anchors_n; ++i)
+  {
+    free( p.anchors[i].name );
+    if(p.anchors[i].owned)
+      oyjlTreeFree( p.anchors[i].node );
+  }
+  if(p.anchors) free( p.anchors );
 
   yaml_parser_delete(&parser);
-  yaml_document_delete(&document);
   if(tmp) free(tmp);
 
-  return jroot;
+  return p.ctx.root;
 }
 #endif
 
@@ -828,6 +828,27 @@ oyjlTESTRESULT_e testString ()
   REGEX_REPLACE( "\033[1mSomeText\033[0m \033[38;2;0;200;0mSomeMoreText\033[0m", "\033[[0-9;]*m", "", "SomeText SomeMoreText" )
   if(t) { free(t); t = NULL; }
 
+  {
+    oyjl_str marked = oyjlStr_New( 10, 0,0 );
+    char * long_text = calloc( 301, 1 );
+    const char * bold = oyjlTermColor( oyjlBOLD, "a" );
+    size_t mark_len = strlen( bold ) - 1;
+    memset( long_text, 'x', 300 );
+    oyjlTermColorToStr( oyjlBOLD, "a", marked );
+    oyjlTermColorToStr( oyjlITALIC, long_text, marked );
+    if(strncmp( oyjlStr(marked), bold, mark_len + 1 ) == 0 &&
+       strstr( oyjlStr(marked), long_text ) &&
+       strlen( oyjlStr(marked) ) == 301 + 2 * mark_len)
+    { PRINT_SUB_INT( oyjlTESTRESULT_SUCCESS, strlen( oyjlStr(marked) ),
+      "oyjlTermColorToStr()" );
+    } else
+    { PRINT_SUB_INT( oyjlTESTRESULT_FAIL, strlen( oyjlStr(marked) ),
+      "oyjlTermColorToStr()" );
+    }
+    free( long_text );
+    oyjlStr_Release( &marked );
+  }
+
   return result;
 }
 
@@ -21,7 +21,8 @@
   TEST_RUN( testUiRoundtrip, "Ui Export", 1 ); \
   TEST_RUN( testUiTranslation, "Ui Translation", 1 ); \
   TEST_RUN( testToolOyjl, "Tool oyjl", 1 ); \
-  TEST_RUN( testToolOyjlTranslation, "Tool oyjl-translation", 1 );
+  TEST_RUN( testToolOyjlTranslation, "Tool oyjl-translation", 1 ); \
+  TEST_RUN( testI18NProfiling, "Translation Profiling", 0 );
 
 void oyjlLibRelease();
 #define OYJL_TEST_MAIN_SETUP  printf("\n    Oyjl Test Program\n");
@@ -100,6 +101,9 @@ char *   testTranslateJson           ( const char        * json,
   return txt;
 }
 
+static int test_tr_released = 0;
+static void testTrDeAlloc( void * user_data OYJL_UNUSED ) { ++test_tr_released; }
+
 extern oyjlMessage_f oyjlMessage_p;
 int          oyjlMessageFunc         ( int/*oyjlMSG_e*/    error_code,
                                        const void        * context_object OYJL_UNUSED,
@@ -522,6 +526,116 @@ oyjlTESTRESULT_e testI18N()
     "oyjlTranslate(\"%s\",%s,\"Color\")", loc, name );
   }
 
+  const char * untranslated = "No translation for this text";
+  clck = oyjlClock();
+  for( i = 0; i < 100; ++i )
+    text = oyjlTranslate( trc, untranslated );
+  clck = oyjlClock() - clck;
+  if( text == untranslated )
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, i,clck/(double)CLOCKS_PER_SEC,"tr",
+    "oyjlTranslate(\"%s\",%s,miss)", loc, name );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyjlTranslate(\"%s\",%s,miss)", loc, name );
+  }
+
+  loc = "back";
+  oyjlTr_SetLocale( trc, loc );
+  clck = oyjlClock();
+  for( i = 0; i < 100; ++i )
+    text = oyjlTranslate( trc, "Barva" );
+  clck = oyjlClock() - clck;
+  /* several msgids share "Barva"; any of them must round trip */
+  txt = oyjlStringCopy( text, 0 );
+  oyjlTr_SetLocale( trc, "cs" );
+  text = oyjlTranslate( trc, txt );
+  if( strcmp(txt,"Barva") != 0 && strcmp(text,"Barva") == 0 )
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, i,clck/(double)CLOCKS_PER_SEC,"tr",
+    "oyjlTranslate(\"%s\",%s,\"Barva\")", loc, name );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyjlTranslate(\"%s\",%s,\"Barva\") %s", loc, name, txt );
+  }
+  myDeAllocFunc( txt ); txt = NULL;
+
+  int error = oyjlTreeSerialiseToFile( oyjlTr_GetCatalog( trc ), 0, "i18n.oiJF" );
+  oyjlTr_s * mapped_trc = NULL;
+  text = NULL;
+  clck = oyjlClock();
+  for( i = 0; !error && i < 1000; ++i )
+  {
+    oyjl_val mapped = oyjlTreeMapFile( "i18n.oiJF", 0, NULL );
+    oyjlTr_Release( &mapped_trc );
+    mapped_trc = oyjlTr_New( "de_DE", OYJL_DOMAIN, &mapped, NULL,NULL,NULL, OYJL_MAPPED );
+  }
+  clck = oyjlClock() - clck;
+  if(mapped_trc)
+    text = oyjlTranslate( mapped_trc, "render" );
+  if( !error && text && strcmp(text,"Darstellung") == 0 )
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, i,clck/(double)CLOCKS_PER_SEC,"tr",
+    "oyjlTr_New(%s,OYJL_MAPPED)", "i18n.oiJF" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyjlTr_New(%s,OYJL_MAPPED) %s", "i18n.oiJF", text?text:"----" );
+  }
+
+  /* the msgid table in the file must resolve like the parsed catalog */
+  const char * mapped_locs[] = { "de_DE", "de", "de_AT", "cs_CZ", "eo", "fr", "ru_RU", NULL };
+  char ** tr_paths = oyjlTreeToPaths( oyjlTr_GetCatalog( trc ), 10000000, NULL, OYJL_KEY, &count );
+  int checked = 0, diffs = 0, l;
+  for(l = 0; mapped_trc && mapped_locs[l]; ++l)
+  {
+    oyjlTr_SetLocale( trc, mapped_locs[l] );
+    oyjlTr_SetLocale( mapped_trc, mapped_locs[l] );
+    for(i = 0; i < count; ++i)
+    {
+      const char * key = strstr( tr_paths[i], "org/freedesktop/oyjl/translations/" ), * a, * b;
+      char * msgid;
+      key = key ? strchr( key + strlen("org/freedesktop/oyjl/translations/"), '/' ) : NULL;
+      if(!key || strstr( tr_paths[i], "translations/back/" ))
+        continue;
+      msgid = oyjlJsonEscape( key + 1, OYJL_REVERSE | OYJL_REGEXP | OYJL_KEY );
+      a = oyjlTranslate( trc, msgid );
+      b = oyjlTranslate( mapped_trc, msgid );
+      ++checked;
+      if(strcmp( a, b ) != 0)
+      {
+        if(verbose)
+          fprintf( zout, "%s \"%s\": \"%s\" != \"%s\"\n", mapped_locs[l], msgid, a, b );
+        ++diffs;
+      }
+      free( msgid );
+    }
+  }
+  oyjlStringListRelease( &tr_paths, count, free );
+  oyjlTr_SetLocale( trc, "cs" );
+  if( checked && !diffs )
+  { PRINT_SUB_INT( oyjlTESTRESULT_SUCCESS, checked,
+    "oyjlTranslate(%s,OYJL_MAPPED) == oyjlTranslate(%s)", "i18n.oiJF", name );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyjlTranslate(%s,OYJL_MAPPED) == oyjlTranslate(%s) %d/%d", "i18n.oiJF", name, diffs, checked );
+  }
+  oyjlTr_Release( &mapped_trc );
+
+  const char * de = NULL, * cs = NULL;
+  clck = oyjlClock();
+  for( i = 0; i < 1000; ++i )
+  {
+    oyjlTr_SetLocale( trc, "de_DE" );
+    de = oyjlTranslate( trc, "render" );
+    oyjlTr_SetLocale( trc, "cs" );
+    cs = oyjlTranslate( trc, "Color" );
+  }
+  clck = oyjlClock() - clck;
+  if( strcmp(de,"Darstellung") == 0 && strcmp(cs,"Barva") == 0 )
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, 2*i,clck/(double)CLOCKS_PER_SEC,"sw",
+    "oyjlTr_SetLocale(%s) %s/%s", name, "de_DE", "cs" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyjlTr_SetLocale(%s) %s/%s %s %s", name, "de_DE", "cs", de, cs );
+  }
+
   int n = 1;
   loc = "de_DE";
   oyjlTr_SetLocale( trc, loc );
@@ -733,6 +847,87 @@ char *     oyjlTreeSerialisedPrint_  ( oyjl_val            v,
   myDeAllocFunc( oyjl_export ); oyjl_export = NULL;
   oyjlTreeFree( root );
 
+  /* a replaced context goes away with the next but one oyjlTr_Set() */
+  test_tr_released = 0;
+  for(i = 0; i < 10; ++i)
+  {
+    trc = oyjlTr_New( "C", "oyjl-test-replace", NULL, NULL,NULL, testTrDeAlloc, 0 );
+    oyjlTr_Set( &trc );
+  }
+  if(test_tr_released == 8)
+  { PRINT_SUB_INT( oyjlTESTRESULT_SUCCESS, test_tr_released,
+    "oyjlTr_Set() releases replaced contexts" );
+  } else
+  { PRINT_SUB_INT( oyjlTESTRESULT_FAIL, test_tr_released,
+    "oyjlTr_Set() releases replaced contexts" );
+  }
+
+  return result;
+}
+
+/* catalog lookups from testI18N() with enough calls for a rate;
+ * runs only when named: oyjl-test "Translation Profiling" */
+oyjlTESTRESULT_e testI18NProfiling()
+{
+  oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
+  const char * locs[] = {"de_DE.UTF8","de_DE","de","cs",NULL},
+             * msgids[] = {"render","render","render","Color"},
+             * translations[] = {"Darstellung","Darstellung","Darstellung","Barva"},
+             * name = "catalog",
+             * text = NULL;
+  oyjl_val catalog;
+  oyjlTr_s * trc;
+  double clck;
+  int i, j, size;
+
+  fprintf(stdout, "\n" );
+
+  size = sizeof(liboyjl_i18n_oiJS);
+  catalog = (oyjl_val) oyjlStringAppendN( NULL, (const char*) liboyjl_i18n_oiJS, size, malloc );
+  trc = oyjlTr_New( locs[0], OYJL_DOMAIN, &catalog, NULL,NULL,NULL, !verbose?0:OYJL_OBSERVE );
+  for(j = 0; locs[j]; ++j)
+  {
+    oyjlTr_SetLocale( trc, locs[j] );
+    clck = oyjlClock();
+    for( i = 0; i < 100000; ++i )
+      text = oyjlTranslate( trc, msgids[j] );
+    clck = oyjlClock() - clck;
+    if( strcmp(text,translations[j]) == 0 )
+    { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, i,clck/(double)CLOCKS_PER_SEC,"tr",
+      "oyjlTranslate(\"%s\",%s,\"%s\") %s", locs[j], name, msgids[j], oyjlTr_GetLang( trc ) );
+    } else
+    { PRINT_SUB( oyjlTESTRESULT_FAIL,
+      "oyjlTranslate(\"%s\",%s,\"%s\")", locs[j], name, msgids[j] );
+    }
+  }
+
+  const char * untranslated = "No translation for this text";
+  clck = oyjlClock();
+  for( i = 0; i < 100000; ++i )
+    text = oyjlTranslate( trc, untranslated );
+  clck = oyjlClock() - clck;
+  if( text == untranslated )
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, i,clck/(double)CLOCKS_PER_SEC,"tr",
+    "oyjlTranslate(\"cs\",%s,miss)", name );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyjlTranslate(\"cs\",%s,miss)", name );
+  }
+
+  oyjlTr_SetLocale( trc, "back" );
+  clck = oyjlClock();
+  for( i = 0; i < 100000; ++i )
+    text = oyjlTranslate( trc, "Barva" );
+  clck = oyjlClock() - clck;
+  if( strcmp(text,"Barva") != 0 )
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, i,clck/(double)CLOCKS_PER_SEC,"tr",
+    "oyjlTranslate(\"back\",%s,\"Barva\")", name );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyjlTranslate(\"back\",%s,\"Barva\")", name );
+  }
+  oyjlTr_Release( &trc );
+
   return result;
 }
 
@@ -1030,6 +1225,25 @@ oyjlTESTRESULT_e testJson ()
   oyjl_val root = 0;
   char error_buffer[128];
   const char * plain;
+
+  oyjl_val interned1 = oyjlTreeParseJson( json, OYJL_INTERN, error_buffer, 128 ),
+           interned2 = oyjlTreeParseJson( json, OYJL_INTERN, error_buffer, 128 );
+  oyjl_val o1 = oyjlTreeGetValue( interned1, 0, "org/free/[1]" ),
+           o2 = oyjlTreeGetValue( interned2, 0, "org/free/[1]" );
+  const char * k1 = oyjlValuePosGetKey( o1, 1 ),
+             * k2 = oyjlValuePosGetKey( o2, 1 ),
+             * e2 = OYJL_GET_STRING( oyjlTreeGetValue( interned2, 0, "org/key_e" ) );
+  if( k1 && k1 == k2 && strcmp( k1, "s2key_d" ) == 0 &&
+      e2 && strcmp( e2, "val_e_yyy" ) == 0 )
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyjlTreeParseJson( OYJL_INTERN )" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyjlTreeParseJson( OYJL_INTERN )" );
+  }
+  oyjlTreeFree( interned1 );
+  oyjlTreeFree( interned2 );
+
   for(i = 0; i < 5; ++i)
   {
     int level = 0;
@@ -1275,6 +1489,27 @@ oyjlTESTRESULT_e testJson ()
   result = testEscapeJsonVal( "my/value", "my%37value", OYJL_KEY, 25, result, oyjlTESTRESULT_XFAIL );
   result = testEscapeJsonVal( "value\nafter_line_break", "value\\nafter_line_break", 0, 39, result, oyjlTESTRESULT_XFAIL );
 
+  const char * escape_text = "org/freedesktop/openicc/device/camera/[0]/EXIF_model \"Rose (2.0)\"\tend";
+  int n = 100000, match = 0;
+  double clck = oyjlClock();
+  for(i = 0; i < n; ++i)
+  {
+    char * escaped = oyjlJsonEscape( escape_text, OYJL_KEY | OYJL_NO_INDEX | OYJL_REGEXP ),
+         * plain = oyjlJsonEscape( escaped, OYJL_REVERSE | OYJL_REGEXP | OYJL_KEY );
+    if(strcmp( plain, escape_text ) == 0)
+      ++match;
+    free( escaped );
+    free( plain );
+  }
+  clck = oyjlClock() - clck;
+  if( match == n )
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, 2*n,clck/(double)CLOCKS_PER_SEC,"esc",
+    "oyjlJsonEscape( OYJL_REVERSE )" );
+  } else
+  { PRINT_SUB_INT( oyjlTESTRESULT_FAIL, match,
+    "oyjlJsonEscape( OYJL_REVERSE )" );
+  }
+
   const char * json2 = "{\n\
   \"org\": {\n\
     \"free\": [{\n\
@@ -1370,9 +1605,39 @@ const char * oyjlTreeGetString_      ( oyjl_val            v,
     for(j = 0; j < count; ++j)
       fprintf( zout, "%s:%s\n", paths[j], oyjlTreeGetString_(value, 0, paths[j]) );
 
+  oyjl_val view = oyjlTreeGetValue( value, 0, paths[2] );
+  char * view_text = oyjlValueText( oyjlTreeGetValue( value, 0, paths[1] ), 0 );
+  if( oyjlValueCount( value ) == 2 &&
+      view && view->type == oyjl_t_number && OYJL_GET_DOUBLE(view) == 1.0 &&
+      view_text && strcmp( view_text, "matrix.from" ) == 0 &&
+      oyjlTreeGetValue( value, 0, "org/free/[1]/missing" ) == NULL )
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyjlTreeGetValue( oiJS )" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyjlTreeGetValue( oiJS )" );
+  }
+  if(view_text) free(view_text);
+
  if(paths && count)
     oyjlStringListRelease( &paths, count, free );
 
+  int error = oyjlTreeSerialiseToFile( value, flags, "oiJS.oiJF" );
+  int map_size = 0;
+  oyjl_val mapped = oyjlTreeMapFile( "oiJS.oiJF", flags | OYJL_VERIFY, &map_size );
+  /* not mapped; must be ignored */
+  oyjlTreeUnmapFile( value );
+  if( !error && mapped && map_size == size &&
+      memcmp( mapped, value, size ) == 0 &&
+      strcmp(oyjlTreeGetString_( mapped, 0, "org/free/[0]/s1key_b" ),"matrix.from") == 0 )
+  { PRINT_SUB_INT( oyjlTESTRESULT_SUCCESS, map_size,
+    "oyjlTreeMapFile( oyjlTreeSerialiseToFile() )" );
+  } else
+  { PRINT_SUB_INT( oyjlTESTRESULT_FAIL, map_size,
+    "oyjlTreeMapFile( oyjlTreeSerialiseToFile() )" );
+  }
+  oyjlTreeUnmapFile( mapped );
+
   root = oyjlTreeDeSerialise( value, flags, size );
   free(value);
   value = root; root = NULL;
@@ -1423,6 +1688,27 @@ const char * oyjlTreeGetString_      ( oyjl_val            v,
     for(j = 0; j < count; ++j)
       fprintf( zout, "%s:%s\n", paths[j], oyjlTreeGetString_(value, 0, paths[j]) );
 
+  int nested_size = 0;
+  oyjl_val nested = oyjlTreeSerialise( value, flags | OYJL_NESTED, &nested_size );
+  oyjl_val nested_array = oyjlTreeGetValue( nested, 0, "org/free" );
+  char * nested_text = oyjlValueText( oyjlTreeGetValue( nested, 0, paths[1] ), 0 ),
+       * nested_text2 = oyjlValueText( oyjlTreeGetValue( nested, 0, paths[7] ), 0 );
+  if( nested && memcmp( nested, "oiJT", 4 ) == 0 &&
+      oyjlValueCount( nested_array ) == 2 &&
+      oyjlValueCount( oyjlValuePosGet( nested_array, 1 ) ) == 2 &&
+      strcmp( oyjlValuePosGetKey( oyjlValuePosGet( nested_array, 1 ), 1 ), "s2key_d" ) == 0 &&
+      nested_text && strcmp( nested_text, "matrix.from" ) == 0 &&
+      nested_text2 && strcmp( nested_text2, "value.property" ) == 0 )
+  { PRINT_SUB_INT( oyjlTESTRESULT_SUCCESS, nested_size,
+    "oyjlTreeSerialise( OYJL_NESTED ) oiJT" );
+  } else
+  { PRINT_SUB_INT( oyjlTESTRESULT_FAIL, nested_size,
+    "oyjlTreeSerialise( OYJL_NESTED ) oiJT" );
+  }
+  if(nested_text) free(nested_text);
+  if(nested_text2) free(nested_text2);
+  oyjlTreeFree( nested );
+
  if(paths && count)
     oyjlStringListRelease( &paths, count, free );
 
@@ -1445,9 +1731,110 @@ const char * oyjlTreeGetString_      ( oyjl_val            v,
   if(text) {free(text); text = NULL;}
   if(tree_text) {free(tree_text); tree_text = NULL;}
 
+  const char * json_rt = "{\n\
+  \"a\": [[1,2,[3,-4]],{\"b\": [true,false],\"c\": null},\"s\"],\n\
+  \"n\": {\"i\": 42,\"d\": -0.125,\"e\": 1.5e+10,\"o\": {\"p\": {\"q\": [0.5]}}},\n\
+  \"z\": \"end\"\n\
+}";
+  root = oyjlTreeParse( json_rt, error_buffer, 128 );
+  level = 0;
+  oyjlTreeToJson( root, &level, &tree_text );
+  size = 0;
+  value = oyjlTreeSerialise( root, flags, &size );
+  oyjlTreeFree( root );
+  root = oyjlTreeDeSerialise( value, flags, size );
+  free( value ); value = NULL;
+  level = 0;
+  oyjlTreeToJson( root, &level, &text );
+  oyjlTreeFree( root ); root = NULL;
+  if(tree_text && text && strcmp( tree_text, text ) == 0)
+  { PRINT_SUB_INT( oyjlTESTRESULT_SUCCESS, size,
+    "oyjlTreeDeSerialise( oyjlTreeSerialise() ) roundtrip" );
+  } else
+  { PRINT_SUB_INT( oyjlTESTRESULT_FAIL, size,
+    "oyjlTreeDeSerialise( oyjlTreeSerialise() ) roundtrip" );
+  }
+  if(verbose && text)
+    fprintf( zout, "%s\n%s\n", tree_text, text );
+  if(text) {free(text); text = NULL;}
+  if(tree_text) {free(tree_text); tree_text = NULL;}
+
+  /* a key with '/' appears escaped in its path */
+  const char * json_slash = "{\"tr\":{\"Input/Output\":\"E/A\"}}";
+  char ** slash_paths = NULL;
+  int slash_n = 0, members;
+  const char * slash_text = NULL;
+  root = oyjlTreeParse( json_slash, error_buffer, 128 );
+  slash_paths = oyjlTreeToPaths( root, 1000000, NULL, OYJL_KEY, &slash_n );
+  if(slash_n == 1)
+    oyjlTreeGetValue( root, OYJL_CREATE_NEW, slash_paths[0] );
+  members = oyjlValueCount( oyjlTreeGetValue( root, 0, "tr" ) );
+  size = 0;
+  value = oyjlTreeSerialise( root, flags, &size );
+  if(value && slash_n == 1)
+    slash_text = OYJL_GET_STRING( oyjlTreeGetValue( value, 0, slash_paths[0] ) );
+  if(members == 1 && slash_text && strcmp( slash_text, "E/A" ) == 0)
+  { PRINT_SUB_INT( oyjlTESTRESULT_SUCCESS, size,
+    "oyjlTreeSerialise( \"%s\" )", slash_n ? slash_paths[0] : "----" );
+  } else
+  { PRINT_SUB_INT( oyjlTESTRESULT_FAIL, size,
+    "oyjlTreeSerialise( \"%s\" ) members: %d", slash_n ? slash_paths[0] : "----", members );
+  }
+  oyjlStringListRelease( &slash_paths, slash_n, free );
+  oyjlTreeFree( value ); value = NULL;
+  oyjlTreeFree( root ); root = NULL;
+
+  /* a block released with free() may come back at the same address;
+   * copying a second block over the first gives the same situation */
+  const char * json_reuse[2] = { "{\"x1\":{\"k\":1}}", "{\"x1\":{\"k\":2}}" };
+  int reuse_found = 0, reuse_size = 0;
+  oyjl_val reuse = NULL;
+  for(i = 0; i < 2; ++i)
+  {
+    oyjl_val v = NULL;
+    root = oyjlTreeParse( json_reuse[i], error_buffer, 128 );
+    size = 0;
+    value = oyjlTreeSerialise( root, flags, &size );
+    oyjlTreeFree( root ); root = NULL;
+    if(i == 0)
+    {
+      reuse = value; value = NULL;
+      reuse_size = size;
+      v = oyjlTreeGetValue( reuse, 0, "x1/k" );
+    }
+    else if(reuse && value && size == reuse_size)
+    {
+      memcpy( reuse, value, size );
+      v = oyjlTreeGetValue( reuse, 0, "x1/k" );
+    }
+    if(OYJL_IS_INTEGER( v ) && OYJL_GET_INTEGER( v ) == i + 1)
+      ++reuse_found;
+    free( value ); value = NULL;
+  }
+  if(reuse_found == 2)
+  { PRINT_SUB_INT( oyjlTESTRESULT_SUCCESS, reuse_size,
+    "oyjlTreeGetValue( oiJS ) after free()" );
+  } else
+  { PRINT_SUB_INT( oyjlTESTRESULT_FAIL, reuse_size,
+    "oyjlTreeGetValue( oiJS ) after free()" );
+  }
+  oyjlTreeFree( reuse ); reuse = NULL;
+
   return result;
 }
 
+typedef struct {
+  oyjl_str text;
+  int calls;
+} testWrite_s;
+static int testWrite( const char * text, size_t len, void * user_data )
+{
+  testWrite_s * w = (testWrite_s*) user_data;
+  oyjlStr_AppendN( w->text, text, len );
+  ++w->calls;
+  return 0;
+}
+
 oyjlTESTRESULT_e testFromJson ()
 {
   oyjlTESTRESULT_e result = oyjlTESTRESULT_UNKNOWN;
@@ -1511,6 +1898,170 @@ oyjlTESTRESULT_e testFromJson ()
   OYJL_TEST_WRITE_RESULT( text, strlen(text), "oyjlTreeToXml", "txt" )
   myDeAllocFunc(text);
 
+  int plain_json, plain_yaml, plain_xml;
+  text = oyjlTreeToText( root, OYJL_JSON | OYJL_NO_MARKUP );
+  plain_json = text && !strchr(text, '\033') ? strlen(text) : 0;
+  myDeAllocFunc(text);
+  text = oyjlTreeToText( root, OYJL_YAML | OYJL_NO_MARKUP );
+  plain_yaml = text && !strchr(text, '\033') ? strlen(text) : 0;
+  myDeAllocFunc(text);
+  text = oyjlTreeToText( root, OYJL_XML | OYJL_NO_MARKUP );
+  plain_xml = text && !strchr(text, '\033') ? strlen(text) : 0;
+  myDeAllocFunc(text);
+  if(plain_json == 413 && plain_yaml == 320 && plain_xml == 443)
+  { PRINT_SUB_INT( oyjlTESTRESULT_SUCCESS, plain_json + plain_yaml + plain_xml,
+    "oyjlTreeToText( OYJL_NO_MARKUP )" );
+  } else
+  { PRINT_SUB_INT( oyjlTESTRESULT_FAIL, plain_json + plain_yaml + plain_xml,
+    "oyjlTreeToText( OYJL_NO_MARKUP )" );
+  }
+
+  text = oyjlTreeToText( root, OYJL_JSON | OYJL_NO_MARKUP | OYJL_JSON_COMPACT );
+  {
+    oyjl_val compact = text ? oyjlTreeParse( text, NULL, 0 ) : NULL;
+    char * json = oyjlTreeToText( compact, OYJL_JSON | OYJL_NO_MARKUP );
+    len = text ? strlen(text) : 0;
+    if(len && len < plain_json && !strchr(text, '\n') && json && (int)strlen(json) == plain_json)
+    { PRINT_SUB_INT( oyjlTESTRESULT_SUCCESS, len,
+      "oyjlTreeToText( OYJL_JSON_COMPACT )" );
+    } else
+    { PRINT_SUB_INT( oyjlTESTRESULT_FAIL, len,
+      "oyjlTreeToText( OYJL_JSON_COMPACT )" );
+    }
+    if(verbose) fprintf( zout, "%s\n", text );
+    myDeAllocFunc(json);
+    oyjlTreeFree( compact );
+  }
+  myDeAllocFunc(text);
+
+  int j, format_flags[3] = { OYJL_JSON, OYJL_YAML, OYJL_XML };
+  for(j = 0; j < 1000; ++j)
+    oyjlTreeSetStringF( root, OYJL_CREATE_NEW, "value", "org/stream/[%d]/key", j );
+  for(j = 0; j < 3; ++j)
+  {
+    testWrite_s w = { NULL, 0 };
+    int error;
+    const char * name = format_flags[j] == OYJL_YAML ? "oyjlTreeWriteYaml()" : format_flags[j] == OYJL_XML ? "oyjlTreeWriteXml()" : "oyjlTreeWriteJson()";
+    w.text = oyjlStr_New( 10, 0,0 );
+    if(format_flags[j] == OYJL_YAML)
+      error = oyjlTreeWriteYaml( root, OYJL_NO_MARKUP, testWrite, &w );
+    else if(format_flags[j] == OYJL_XML)
+      error = oyjlTreeWriteXml( root, OYJL_NO_MARKUP, testWrite, &w );
+    else
+      error = oyjlTreeWriteJson( root, OYJL_NO_MARKUP, testWrite, &w );
+    text = oyjlTreeToText( root, format_flags[j] | OYJL_NO_MARKUP );
+    if(!error && text && w.calls > 1 && strcmp( oyjlStr(w.text), text ) == 0)
+    { PRINT_SUB_INT( oyjlTESTRESULT_SUCCESS, w.calls,
+      "%s chunks", name );
+    } else
+    { PRINT_SUB_INT( oyjlTESTRESULT_FAIL, w.calls,
+      "%s chunks", name );
+    }
+    myDeAllocFunc(text);
+    oyjlStr_Release( &w.text );
+  }
+
+  oyjl_val big = oyjlTreeNew( "" );
+  const char * big_value = "a rather long value: with \"quotes\" to be escaped for YAML output and some more padding text";
+  int k, rows = 1000, cols = 100;
+  for(j = 0; j < rows; ++j)
+    for(k = 0; k < cols; ++k)
+      oyjlTreeSetStringF( big, OYJL_CREATE_NEW, big_value, "org/big/[%d]/key_%d", j, k );
+  double clck = oyjlClock();
+  text = oyjlTreeToText( big, OYJL_YAML | OYJL_NO_MARKUP );
+  clck = oyjlClock() - clck;
+  len = text ? strlen(text) : 0;
+  if(len > 10000000)
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, len/1000000,clck/(double)CLOCKS_PER_SEC,"MB",
+    "oyjlTreeToText( OYJL_YAML ) %d bytes", len );
+  } else
+  { PRINT_SUB_INT( oyjlTESTRESULT_FAIL, len,
+    "oyjlTreeToText( OYJL_YAML )" );
+  }
+#if defined(OYJL_HAVE_YAML)
+  {
+    oyjl_val yroot;
+    char * json = oyjlTreeToText( big, OYJL_JSON | OYJL_NO_MARKUP | OYJL_JSON_COMPACT ),
+         * reparsed;
+    clck = oyjlClock();
+    yroot = oyjlTreeParseYaml( text, 0, NULL, 0 );
+    clck = oyjlClock() - clck;
+    reparsed = oyjlTreeToText( yroot, OYJL_JSON | OYJL_NO_MARKUP | OYJL_JSON_COMPACT );
+    if(json && reparsed && strcmp( json, reparsed ) == 0)
+    { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, len/1000000,clck/(double)CLOCKS_PER_SEC,"MB",
+      "oyjlTreeParseYaml( %d bytes )", len );
+    } else
+    { PRINT_SUB_INT( oyjlTESTRESULT_FAIL, reparsed ? strlen(reparsed) : 0,
+      "oyjlTreeParseYaml( %d bytes )", len );
+    }
+    myDeAllocFunc(json);
+    myDeAllocFunc(reparsed);
+    oyjlTreeFree( yroot );
+  }
+  {
+    const char * yaml = "a: &A {k: 1, l: [2, 3]}\nb: *A\nc: {}\n";
+    oyjl_val yroot = oyjlTreeParseYaml( yaml, OYJL_NUMBER_DETECTION, NULL, 0 );
+    char * reparsed = oyjlTreeToText( yroot, OYJL_JSON | OYJL_NO_MARKUP | OYJL_JSON_COMPACT );
+    if(reparsed && strcmp( reparsed, "{\"a\":{\"k\":1,\"l\":[2,3]},\"b\":{\"k\":1,\"l\":[2,3]},\"c\":{}}" ) == 0)
+    { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+      "oyjlTreeParseYaml( alias )" );
+    } else
+    { PRINT_SUB( oyjlTESTRESULT_FAIL,
+      "oyjlTreeParseYaml( alias ) %s", reparsed ? reparsed : "---" );
+    }
+    myDeAllocFunc(reparsed);
+    oyjlTreeFree( yroot );
+  }
+#endif
+  myDeAllocFunc(text);
+
+  {
+    testWrite_s w = { NULL, 0 };
+    char * compact = oyjlTreeToText( root, OYJL_JSON | OYJL_NO_MARKUP | OYJL_JSON_COMPACT ),
+         * reparsed = NULL;
+    oyjl_val gen_root;
+    int error;
+    w.text = oyjlStr_New( 10, 0,0 );
+    error = oyjlTreeWriteJsonYajl( root, 0, testWrite, &w );
+    gen_root = oyjlTreeParse( oyjlStr(w.text), NULL, 0 );
+    reparsed = oyjlTreeToText( gen_root, OYJL_JSON | OYJL_NO_MARKUP | OYJL_JSON_COMPACT );
+    if(!error && compact && reparsed && strcmp( compact, reparsed ) == 0)
+    { PRINT_SUB_INT( oyjlTESTRESULT_SUCCESS, strlen(oyjlStr(w.text)),
+      "oyjlTreeWriteJsonYajl()" );
+    } else
+    { PRINT_SUB_INT( oyjlTESTRESULT_FAIL, strlen(oyjlStr(w.text)),
+      "oyjlTreeWriteJsonYajl()" );
+    }
+    myDeAllocFunc(compact);
+    myDeAllocFunc(reparsed);
+    oyjlTreeFree( gen_root );
+    oyjlStr_Release( &w.text );
+  }
+
+  for(j = 0; j < 2; ++j)
+  {
+    testWrite_s w = { NULL, 0 };
+    int error;
+    const char * name = j ? "oyjlTreeWriteJsonYajl()" : "oyjlTreeWriteJson()";
+    w.text = oyjlStr_New( 10, 0,0 );
+    clck = oyjlClock();
+    if(j)
+      error = oyjlTreeWriteJsonYajl( big, OYJL_JSON_COMPACT, testWrite, &w );
+    else
+      error = oyjlTreeWriteJson( big, OYJL_NO_MARKUP | OYJL_JSON_COMPACT, testWrite, &w );
+    clck = oyjlClock() - clck;
+    len = strlen( oyjlStr(w.text) );
+    if(!error && len > 10000000)
+    { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, len/1000000,clck/(double)CLOCKS_PER_SEC,"MB",
+      "%s %d bytes", name, len );
+    } else
+    { PRINT_SUB_INT( oyjlTESTRESULT_FAIL, len,
+      "%s", name );
+    }
+    oyjlStr_Release( &w.text );
+  }
+  oyjlTreeFree( big );
+
   oyjlTreeFree( root );
 
   return result;
@@ -1614,6 +2165,45 @@ oyjlTESTRESULT_e testJsonRoundtrip () /* Data Readers */
     fprintf( zout, "%s\n", text_to_xml );
   }
   OYJL_TEST_WRITE_RESULT( text_to_xml, strlen(text_to_xml), "oyjlTreeToXml", "txt" )
+
+  xml = "<a xmlns=\"http://d\" b=\"1\" f=\"x &amp; y &lt;z&gt;\"><c>2</c><c>3</c><!-- skip -->mixed<d><![CDATA[raw <x>]]></d><e>x &amp; y</e></a>";
+  root = oyjlTreeParseXml( xml, OYJL_NUMBER_DETECTION, error_buffer, 128 );
+  myDeAllocFunc(text);
+  text = oyjlTreeToText( root, OYJL_JSON | OYJL_NO_MARKUP | OYJL_JSON_COMPACT );
+  oyjlTreeFree( root ); root = NULL;
+  if(text && strcmp( text, "{\"a\":{\"@xmlns\":\"http://d\",\"@b\":\"1\",\"@f\":\"x & y <z>\",\"c\":[2,3],\"d\":{\"@cdata\":\"raw <x>\"},\"e\":\"x & y\"}}" ) == 0)
+  { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+    "oyjlTreeParseXml( mixed )" );
+  } else
+  { PRINT_SUB( oyjlTESTRESULT_FAIL,
+    "oyjlTreeParseXml( mixed ) %s", text ? text : "---" );
+  }
+  myDeAllocFunc(text); text = NULL;
+
+  {
+    int i, n = 100000;
+    oyjl_str str = oyjlStr_New( 10, 0,0 );
+    char * big;
+    double clck;
+    oyjlStr_AppendN( str, "<org>", 5 );
+    for(i = 0; i < n; ++i)
+      oyjlStr_Add( str, "<item id=\"%d\"><name>item</name><value>%d</value></item>", i, i );
+    oyjlStr_AppendN( str, "</org>", 6 );
+    big = oyjlStr_Pull( str );
+    oyjlStr_Release( &str );
+    clck = oyjlClock();
+    root = oyjlTreeParseXml( big, OYJL_NUMBER_DETECTION, error_buffer, 128 );
+    clck = oyjlClock() - clck;
+    if(oyjlValueCount( oyjlTreeGetValue( root, 0, "org/item" ) ) == n)
+    { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, n,clck/(double)CLOCKS_PER_SEC,"elem",
+      "oyjlTreeParseXml( %d bytes )", (int)strlen(big) );
+    } else
+    { PRINT_SUB( oyjlTESTRESULT_FAIL,
+      "oyjlTreeParseXml( %d bytes )", (int)strlen(big) );
+    }
+    oyjlTreeFree( root ); root = NULL;
+    free( big );
+  }
 #endif
   myDeAllocFunc(text_from_xml); text_from_xml = NULL;
   myDeAllocFunc(text_to_xml); text_to_xml = NULL;
@@ -2474,6 +3064,36 @@ oyjlTESTRESULT_e testToolOyjl ()
   int count = 14;
   result = testTool( "oyjl", 3909/*help size*/, commands_oyjl, count, result, oyjlTESTRESULT_FAIL );
 
+  char * command = NULL, * t;
+  char info[48];
+  int size = 0;
+  oyjlStringAdd( &command, 0,0, "%s/%s", OYJL_BUILDDIR, "xmltojson" );
+  if(command && oyjlIsFile( command, "r", info, 48 ))
+  {
+    t = oyjlReadCommandF( &size, "r", malloc, "rm -rf xb xb_out xb_out2; mkdir -p xb/a xb/b && echo '<r><v>1</v></r>' > xb/a/x.xml && echo '<s w=\"2\"/>' > xb/a/y.xml && echo '<t/>' > xb/b/x.xml && %s -o xb_out -j 2 xb/a && cat xb_out/x.json xb_out/y.json", command );
+    if(t && strcmp( t, "{\n  \"r\": {\n    \"v\": \"1\"\n  }\n}\n{\n  \"s\": {\n    \"@w\": \"2\"\n  }\n}\n" ) == 0)
+    { PRINT_SUB_INT( oyjlTESTRESULT_SUCCESS, size,
+      "xmltojson -o DIR -j 2 dir" );
+    } else
+    { PRINT_SUB_INT( oyjlTESTRESULT_FAIL, size,
+      "xmltojson -o DIR -j 2 dir" );
+    }
+    if(verbose && t)
+      fprintf( zout, "%s\n", t );
+    if(t) {free(t);}
+
+    t = oyjlReadCommandF( &size, "r", malloc, "%s -o xb_out2 xb/a xb/b 2>/dev/null; echo $?; ls xb_out2 | wc -l", command );
+    if(t && strcmp( t, "1\n0\n" ) == 0)
+    { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+      "xmltojson -o DIR a/x.xml b/x.xml collision" );
+    } else
+    { PRINT_SUB( oyjlTESTRESULT_FAIL,
+      "xmltojson -o DIR a/x.xml b/x.xml collision %s", t ? t : "---" );
+    }
+    if(t) {free(t);}
+  }
+  if(command) {free(command);}
+
   return result;
 }
 
@@ -2513,19 +3133,65 @@ msgstr \"\"\n\
     fprintf( zout, "de.po:\n%s\n", po );
 
   oyjl_command_test_s commands_oyjl_translate[] = {
-    { "-X export > oyjl-translate-ui.json && cat oyjl-translate-ui.json", 25417,  NULL,       NULL },
-    { "-e -i oyjl-translate-ui.json -o i18n.c -f '_(\"%s\");\n' -k name,description,help && cat i18n.c", 4127,  NULL,       NULL },
+    { "-X export > oyjl-translate-ui.json && cat oyjl-translate-ui.json", 26407,  NULL,       NULL },
+    { "-e -i oyjl-translate-ui.json -o i18n.c -f '_(\"%s\");\n' -k name,description,help && cat i18n.c", 4293,  NULL,       NULL },
 #ifdef OYJL_USE_GETTEXT
-    { "-a -i oyjl-translate-ui.json -o oyjl-translate-ui-i18n.json -k name,description,help -d oyjl -p locale -l=de_DE,cs_CZ && cat oyjl-translate-ui-i18n.json", 33581, NULL,       NULL },
+    { "-a -i oyjl-translate-ui.json -o oyjl-translate-ui-i18n.json -k name,description,help -d oyjl -p locale -l=de_DE,cs_CZ > /dev/null && oyjl count -i oyjl-translate-ui-i18n.json -x org/freedesktop/oyjl/translations", 2, "2",        "oyjl-translate -a ... -l=de_DE,cs_CZ -> 2 locales" },
+    { "-a -i oyjl-translate-ui.json -o oyjl-translate-ui-i18n-j2.json -k name,description,help -d oyjl -p locale -l=de_DE,cs_CZ -j 2 > /dev/null && cmp oyjl-translate-ui-i18n.json oyjl-translate-ui-i18n-j2.json && echo same", 5, "same",     "oyjl-translate -a ... -j 2 == oyjl-translate -a ..." },
 #endif
-    { "-V; xgettext --add-comments --keyword=gettext --flag=gettext:1:pass-c-format --keyword=_ --flag=_:1:pass-c-format --keyword=N_ --flag=N_:1:pass-c-format  --copyright-holder='Kai-Uwe Behrmann'  --msgid-bugs-address='ku.b@gmx.de' --from-code=utf-8 --package-name=i18n --package-version=1.0.0 -o i18n.pot i18n.c && cat i18n.pot", 7742,  NULL,       "xgettext ... i18n.c -> i18n.pot; hand translate -> de.po(prepared example)" },
+    { "-V > /dev/null; xgettext --add-comments --keyword=gettext --flag=gettext:1:pass-c-format --keyword=_ --flag=_:1:pass-c-format --keyword=N_ --flag=N_:1:pass-c-format  --copyright-holder='Kai-Uwe Behrmann'  --msgid-bugs-address='ku.b@gmx.de' --from-code=utf-8 --package-name=i18n --package-version=1.0.0 -o i18n.pot i18n.c && grep -c '^msgid ' i18n.pot", 4, "120",      "xgettext ... i18n.c -> i18n.pot = 119 msgids + header; hand translate -> de.po(prepared example)" },
     { "-c -i de.po --locale=de_DE -o i18n-de_DE.json && cat i18n-de_DE.json", 320, NULL,       NULL }
   };
   int count = 4;
 #ifdef OYJL_USE_GETTEXT
-  ++count;
+  count += 2;
 #endif
-  result = testTool( "oyjl-translate", 4386/*help size*/, commands_oyjl_translate, count, result, oyjlTESTRESULT_FAIL );
+  result = testTool( "oyjl-translate", 4601/*help size*/, commands_oyjl_translate, count, result, oyjlTESTRESULT_FAIL );
+
+  const char * po_langs[] = {"cs","de","eo","eu","fr","ru",NULL};
+  int i, messages = 0;
+  double clck = oyjlClock();
+  for(i = 0; po_langs[i]; ++i)
+  {
+    int size = 0;
+    char * txt = oyjlReadCommandF( &size, "r", malloc, "LANG=C PATH=%s:$PATH oyjl-translate -c -i %s/po/%s.po --locale=%s -o - 2>/dev/null", OYJL_BUILDDIR, OYJL_SOURCEDIR, po_langs[i], po_langs[i] );
+    oyjl_val root = txt ? oyjlTreeParse( txt, NULL, 0 ) : NULL;
+    oyjl_val lang = oyjlTreeGetValueF( root, 0, "org/freedesktop/oyjl/translations/%s", po_langs[i] );
+    int j, n = oyjlValueCount( lang );
+    messages += n;
+    /* a multi line msgid; key and value both carry a real newline */
+    for(j = 0; strcmp( po_langs[i], "de" ) == 0 && j < n; ++j)
+    {
+      const char * key = oyjlValuePosGetKey( lang, j ),
+                 * value = OYJL_GET_STRING( oyjlValuePosGet( lang, j ) );
+      if(!key || strncmp( key, "Read external storage", 21 ) != 0)
+        continue;
+      if( value &&
+          strcmp( key, "Read external storage for global data access, like downloads, music ...\nWrite external storage to create and modify global data." ) == 0 &&
+          strcmp( value, "Lese externe Speicher für globalen Datenzugriff, wie Downloads, Musik ...\nSchreibe externen Speicher zum Erzeugen und Verändern globaler Daten." ) == 0 )
+      { PRINT_SUB( oyjlTESTRESULT_SUCCESS,
+        "oyjl-translate -c -i po/de.po escapes" );
+      } else
+      { PRINT_SUB( oyjlTESTRESULT_FAIL,
+        "oyjl-translate -c -i po/de.po escapes %s", value ? value : "---" );
+      }
+      break;
+    }
+    if(strcmp( po_langs[i], "de" ) == 0 && j == n)
+    { PRINT_SUB( oyjlTESTRESULT_FAIL,
+      "oyjl-translate -c -i po/de.po escapes not found" );
+    }
+    oyjlTreeFree( root );
+    if(txt) free( txt );
+  }
+  clck = oyjlClock() - clck;
+  if( messages == 620 )
+  { PRINT_SUB_PROFILING( oyjlTESTRESULT_SUCCESS, messages,clck/(double)CLOCKS_PER_SEC,"msg",
+    "oyjl-translate -c -i po/*.po = %d", messages );
+  } else
+  { PRINT_SUB_INT( oyjlTESTRESULT_FAIL, messages,
+    "oyjl-translate -c -i po/*.po" );
+  }
 
   return result;
 }/* --- end actual tests --- */
@@ -111,6 +111,8 @@ char * openiccReadFile( const char * file_name,
 int    openiccWriteFile(const char * file_name,
                         void       * ptr,
                         int          size );
+int    openiccWriteTree(const char * file_name,
+                        oyjl_val     root );
 int openiccIsFileFull_ (const char* fullFileName, const char * read_mode);
 char * openiccExtractPathFromFileName_(const char        * file_name );
 int    openiccIsDirFull_             ( const char        * name );
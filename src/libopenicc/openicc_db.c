@@ -470,36 +470,17 @@ int      openiccDBSetString          ( const char        * keyName,
                    openiccScopeGetString(scope), keyName?keyName:"" );
         } else
         {
-          char * json = NULL;
-          int size = 0, result = 0;
-
-          json = oyjlTreeToText( root, OYJL_NO_MARKUP );
-          if(json)
-          {
-            size = strlen(json);
-            if(size)
-            {
-              result = openiccWriteFile( file_name, json, size );
-              if(result != size)
-              { error = 1;
-                ERRcc_S( db, "%s [%s]/%s",
-                         _("Writing failed for"), file_name,
-                         openiccScopeGetString(scope), keyName?keyName:"" );
-              }
-            }
-            else
-            { error = 1;
-              ERRcc_S( db, "%s [%s]/%s",
-                       _("No JSON content obtained for"),
-                       openiccScopeGetString(scope), keyName?keyName:"" );
-            }
-
-            free( json ); json = NULL;
+          int result = openiccWriteTree( file_name, root );
+          if(result < 0)
+          { error = 1;
+            ERRcc_S( db, "%s [%s]/%s",
+                     _("Writing failed for"), file_name,
+                     openiccScopeGetString(scope), keyName?keyName:"" );
           }
-          else
+          else if(result == 0)
           { error = 1;
             ERRcc_S( db, "%s [%s]/%s",
-                     _("No JSON obtained for"),
+                     _("No JSON content obtained for"),
                      openiccScopeGetString(scope), keyName?keyName:"" );
           }
         }
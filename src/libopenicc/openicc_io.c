@@ -358,3 +358,72 @@ int  openiccWriteFile ( const char * filename,
 
   return written_n;
 }
+
+typedef struct {
+  const char * file_name;
+  char       * tmp_name;
+  FILE       * fp;
+  int          written;
+} openiccWriteTree_s;
+
+/* open <file>.tmp with the first chunk, so nothing is touched without content */
+static int openiccWriteTreeCb_ ( const char * text,
+                                 size_t       len,
+                                 void       * user_data )
+{
+  openiccWriteTree_s * w = (openiccWriteTree_s*) user_data;
+  int r = 0;
+
+  if(!w->fp)
+  {
+    char * path = openiccExtractPathFromFileName_( w->file_name );
+    r = openiccMakeDir_( path );
+    if(path) free( path );
+    if(!r)
+    {
+      oyjlStringAdd( &w->tmp_name, 0,0, "%s.tmp", w->file_name );
+      if(!w->tmp_name)
+        return ENOMEM;
+      w->fp = fopen( w->tmp_name, "wb" );
+    }
+    if(!w->fp)
+      return r ? r : errno ? errno : 1;
+  }
+
+  r = oyjlWriteToFILE( text, len, w->fp );
+  if(!r)
+    w->written += len;
+  return r;
+}
+
+/* stream the tree as plain JSON into filename.tmp and rename it to filename,
+ * so readers see the old or the complete new file
+ * @return written size, 0 for no content or -1 on error */
+int  openiccWriteTree ( const char * filename,
+                        oyjl_val     root )
+{
+  openiccWriteTree_s w = { NULL, NULL, NULL, 0 };
+  int r;
+
+  if(!filename || !root)
+    return -1;
+
+  w.file_name = filename;
+  r = oyjlTreeWriteJson( root, OYJL_NO_MARKUP, openiccWriteTreeCb_, &w );
+  if(w.fp && fclose( w.fp ) != 0 && !r)
+    r = errno ? errno : EIO;
+#if !HAVE_POSIX
+  /* rename() does not replace existing files there */
+  if(w.fp && !r)
+    remove( filename );
+#endif
+  if(w.fp && !r && rename( w.tmp_name, filename ) != 0)
+    r = errno ? errno : EIO;
+  if(r && w.tmp_name)
+    remove( w.tmp_name );
+  if(w.tmp_name) free( w.tmp_name );
+  if(r && *openicc_debug > 1)
+    WARNc_S("%s : %s", strerror(r), filename);
+
+  return r ? -1 : w.written;
+}